@@ -1,8 +1,15 @@
+#include <algorithm>
+#include <chrono>
 #include <clingcon.h>
 #include <clingo.hh>
+#include <cstring>
 #include <fstream>
+#include <limits>
+#include <numeric>
 #include <optional>
+#include <random>
 #include <sstream>
+#include <stdexcept>
 
 #ifdef CLINGCON_PROFILE
 #include <gperftools/profiler.h>
@@ -10,6 +17,13 @@
 
 using Clingo::Detail::handle_error;
 
+//! Initial fraction of variables fixed in a round of large neighborhood search.
+constexpr double LNS_FIXED_INIT{0.8};
+//! Maximum fraction of variables fixed in a round of large neighborhood search.
+constexpr double LNS_FIXED_MAX{0.95};
+//! Change of the fraction of fixed variables after a round without improvement.
+constexpr double LNS_FIXED_STEP{0.1};
+
 class Rewriter {
   public:
     Rewriter(clingcon_theory_t *theory, clingo_program_builder_t *builder) : theory_{theory}, builder_{builder} {}
@@ -55,12 +69,23 @@ class ClingconApp final : public Clingo::Application, private Clingo::SolveEvent
 
     void register_options(Clingo::ClingoOptions &options) override {
         handle_error(clingcon_register_options(theory_, options.to_c()));
+
+        char const *group = "CSP Options";
+        options.add(group, "lns-rounds",
+                    "Improve the first solution with at most <n> rounds of large neighborhood search [0]",
+                    [this](char const *value) { return parse_num_(value, lns_rounds_); }, false, "<n>");
+        options.add(group, "lns-conflicts", "Restrict rounds of large neighborhood search to <n> conflicts [1000]",
+                    [this](char const *value) { return parse_num_(value, lns_conflicts_) && lns_conflicts_ > 0; },
+                    false, "<n>");
     }
 
     void validate_options() override { handle_error(clingcon_validate_options(theory_)); }
 
     auto on_model(Clingo::Model &model) -> bool override {
         handle_error(clingcon_on_model(theory_, model.to_c()));
+        if (lns_rounds_ > 0) {
+            store_incumbent_(model);
+        }
         return true;
     }
 
@@ -111,6 +136,22 @@ class ClingconApp final : public Clingo::Application, private Clingo::SolveEvent
     }
     void on_statistics(Clingo::UserStatistics step, Clingo::UserStatistics accu) override {
         handle_error(clingcon_on_statistics(theory_, step.to_c(), accu.to_c()));
+        if (lns_rounds_ > 0) {
+            using Clingo::StatisticsType;
+            auto lns = accu.add_subkey("LNS", StatisticsType::Map);
+            lns.add_subkey("Rounds", StatisticsType::Value).set_value(static_cast<double>(lns_stats_.rounds));
+            lns.add_subkey("Improvements", StatisticsType::Value)
+                .set_value(static_cast<double>(lns_stats_.improvements));
+            lns.add_subkey("Fixed", StatisticsType::Value).set_value(lns_fixed_);
+            lns.add_subkey("Optimal", StatisticsType::Value).set_value(lns_stats_.optimal ? 1 : 0);
+            auto trace = lns.add_subkey("Trace", StatisticsType::Array);
+            for (size_t i = trace.size(); i < lns_stats_.trace.size(); ++i) {
+                auto [time, cost] = lns_stats_.trace[i];
+                auto entry = trace.push(StatisticsType::Map);
+                entry.add_subkey("Time", StatisticsType::Value).set_value(time);
+                entry.add_subkey("Cost", StatisticsType::Value).set_value(static_cast<double>(cost));
+            }
+        }
     }
 
     void main(Clingo::Control &control, Clingo::StringSpan files) override { // NOLINT(bugprone-exception-escape)
@@ -126,15 +167,191 @@ class ClingconApp final : public Clingo::Application, private Clingo::SolveEvent
 #ifdef CLINGCON_PROFILE
         ProfilerStart("clingcon.solve.prof");
 #endif
-        control.solve(Clingo::SymbolicLiteralSpan{}, this, false, false).get();
+        if (lns_rounds_ > 0 && has_minimize_(control)) {
+            solve_lns_(control);
+        } else {
+            control.solve(Clingo::SymbolicLiteralSpan{}, this, false, false).get();
+        }
 #ifdef CLINGCON_PROFILE
         ProfilerStop();
 #endif
     }
 
   private:
+    //! Statistics of the large neighborhood search.
+    struct LNSStats {
+        uint64_t rounds{0};                            //!< number of rounds
+        uint64_t improvements{0};                      //!< number of rounds that improved the incumbent
+        bool optimal{false};                           //!< whether the incumbent has been proven optimal
+        std::vector<std::pair<double, int64_t>> trace; //!< time in seconds and cost of each incumbent
+    };
+
+    template <class T> [[nodiscard]] static auto parse_num_(char const *value, T &target) -> bool {
+        char *end = nullptr;
+        auto num = std::strtoull(value, &end, 10); // NOLINT
+        if (end == value || *end != '\0' || num > std::numeric_limits<T>::max()) {
+            return false;
+        }
+        target = static_cast<T>(num);
+        return true;
+    }
+
+    [[nodiscard]] static auto has_minimize_(Clingo::Control &control) -> bool {
+        for (auto atom : control.theory_atoms()) {
+            auto term = atom.term();
+            // maximize directives are added to the minimize constraint with
+            // negated coefficients and __csp_cost reports the value of the
+            // minimize constraint, i.e., a smaller cost is always better
+            if (term.type() == Clingo::TheoryTermType::Symbol &&
+                (std::strcmp(term.name(), "minimize") == 0 || std::strcmp(term.name(), "maximize") == 0) &&
+                !atom.elements().empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Record the values of the given model if it improves the incumbent.
+    void store_incumbent_(Clingo::Model const &model) {
+        std::optional<int64_t> cost;
+        for (auto const &sym : model.symbols(Clingo::ShowType::Theory)) {
+            if (sym.match("__csp_cost", 1) && sym.arguments()[0].type() == Clingo::SymbolType::String) {
+                cost = std::stoll(sym.arguments()[0].string());
+            }
+        }
+        if (!cost.has_value()) {
+            // the minimize constraint has been translated and is handled by clasp
+            lns_cost_missing_ = true;
+            return;
+        }
+        if (cost_.has_value() && *cost >= *cost_) {
+            return;
+        }
+
+        cost_ = cost;
+        incumbent_.clear();
+        auto thread_id = model.thread_id();
+        size_t index = 0;
+        clingcon_assignment_begin(theory_, thread_id, &index);
+        while (clingcon_assignment_next(theory_, thread_id, &index)) {
+            if (clingcon_assignment_has_value(theory_, thread_id, index)) {
+                clingcon_value_t value;
+                clingcon_assignment_get_value(theory_, thread_id, index, &value);
+                incumbent_.emplace_back(index, value.int_number); // NOLINT
+            }
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - lns_start_;
+        lns_stats_.trace.emplace_back(elapsed.count(), *cost);
+    }
+
+    //! Add assumptions fixing the variable at the given index of the
+    //! incumbent to its value.
+    void fix_(Clingo::Control &control, size_t index, std::vector<Clingo::literal_t> &assumptions) {
+        auto [var, value] = incumbent_[index];
+        clingo_literal_t lit{0};
+        handle_error(clingcon_get_bound_literal(theory_, control.to_c(), var, value, &lit));
+        assumptions.emplace_back(lit);
+        handle_error(clingcon_get_bound_literal(theory_, control.to_c(), var, value - 1, &lit));
+        assumptions.emplace_back(-lit);
+    }
+
+    //! Select the variables to fix in the given round.
+    //!
+    //! Even rounds fix a random subset of the variables and odd rounds a
+    //! random window of consecutive variables.
+    auto neighborhood_(Clingo::Control &control, uint64_t round) -> std::vector<Clingo::literal_t> {
+        auto size = incumbent_.size();
+        if (size == 0) {
+            return {};
+        }
+        auto fixed = static_cast<size_t>(lns_fixed_ * static_cast<double>(size));
+        std::vector<size_t> indices(size);
+        if (round % 2 == 0) {
+            std::iota(indices.begin(), indices.end(), 0);
+            std::shuffle(indices.begin(), indices.end(), lns_rng_);
+        } else {
+            auto start = std::uniform_int_distribution<size_t>{0, size - 1}(lns_rng_);
+            for (size_t i = 0; i < size; ++i) {
+                indices[i] = (start + i) % size;
+            }
+        }
+
+        std::vector<Clingo::literal_t> assumptions;
+        for (size_t i = 0; i < fixed; ++i) {
+            fix_(control, indices[i], assumptions);
+        }
+        return assumptions;
+    }
+
+    //! Minimize using large neighborhood search.
+    //!
+    //! After a first solution has been found, each round fixes a subset of
+    //! the variables to their values in the incumbent and searches for a
+    //! better solution with a limited number of conflicts. The fraction of
+    //! fixed variables decreases if the neighborhood has been searched
+    //! exhaustively and increases if the conflict limit has been hit. The
+    //! incumbent is reported again in a final solve call.
+    void solve_lns_(Clingo::Control &control) {
+        lns_start_ = std::chrono::steady_clock::now();
+        auto limit = control.configuration()["solve"]["solve_limit"];
+        limit = std::to_string(lns_conflicts_).c_str();
+
+        // search for a first solution
+        while (!cost_.has_value()) {
+            auto ret = control.solve(Clingo::LiteralSpan{}, this, false, false).get();
+            if (lns_cost_missing_) {
+                throw std::runtime_error("large neighborhood search does not support translated minimize constraints, "
+                                         "use --translate-opt=0");
+            }
+            if (ret.is_exhausted() || ret.is_interrupted()) {
+                lns_stats_.optimal = ret.is_exhausted() && cost_.has_value();
+                return;
+            }
+        }
+
+        // improve the incumbent
+        for (uint64_t round = 0; round < lns_rounds_; ++round) {
+            ++lns_stats_.rounds;
+            auto cost = *cost_;
+            handle_error(clingcon_set_minimize_bound(theory_, cost - 1));
+            auto assumptions = neighborhood_(control, round);
+            auto ret = control.solve(Clingo::LiteralSpan{assumptions}, this, false, false).get();
+            if (ret.is_interrupted()) {
+                break;
+            }
+            if (*cost_ < cost) {
+                ++lns_stats_.improvements;
+            } else if (!ret.is_exhausted()) {
+                lns_fixed_ = std::min(LNS_FIXED_MAX, lns_fixed_ + LNS_FIXED_STEP);
+            } else if (!assumptions.empty()) {
+                lns_fixed_ = std::max(0.0, lns_fixed_ - LNS_FIXED_STEP);
+            } else {
+                lns_stats_.optimal = true;
+                break;
+            }
+        }
+
+        // report the incumbent
+        limit = "umax";
+        handle_error(clingcon_set_minimize_bound(theory_, *cost_));
+        std::vector<Clingo::literal_t> assumptions;
+        for (size_t i = 0; i < incumbent_.size(); ++i) {
+            fix_(control, i, assumptions);
+        }
+        control.solve(Clingo::LiteralSpan{assumptions}, this, false, false).get();
+    }
+
     clingcon_theory_t *theory_{nullptr};
     std::vector<Clingo::Symbol> symvec_;
+    uint64_t lns_rounds_{0};
+    uint64_t lns_conflicts_{1000}; // NOLINT
+    double lns_fixed_{LNS_FIXED_INIT};
+    std::mt19937 lns_rng_;
+    std::chrono::steady_clock::time_point lns_start_;
+    std::optional<int64_t> cost_;
+    bool lns_cost_missing_{false};
+    std::vector<std::pair<size_t, int>> incumbent_;
+    LNSStats lns_stats_;
 };
 
 auto main(int argc, char *argv[]) -> int { // NOLINT(bugprone-exception-escape)
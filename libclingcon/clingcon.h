@@ -98,6 +98,9 @@ typedef struct clingcon_theory clingcon_theory_t;
 //! Callback to rewrite statements (see ::clingcon_rewrite_ast).
 typedef bool (*clingcon_ast_callback_t)(clingo_ast_t *ast, void *data);
 
+//! Callback to inspect total assignments (see ::clingcon_on_check).
+typedef bool (*clingcon_check_callback_t)(clingcon_theory_t *theory, uint32_t thread_id, void *data);
+
 //! Return the version of the theory.
 CLINGCON_VISIBILITY_DEFAULT void clingcon_version(int *major, int *minor, int *patch);
 
@@ -134,6 +137,12 @@ CLINGCON_VISIBILITY_DEFAULT bool clingcon_validate_options(clingcon_theory_t *th
 //! Callback for models.
 CLINGCON_VISIBILITY_DEFAULT bool clingcon_on_model(clingcon_theory_t *theory, clingo_model_t *model);
 
+//! Only accept models whose cost is less than or equal to the given bound in
+//! the next solve call.
+//!
+//! This can be used to keep the bound of the incumbent across solve calls.
+CLINGCON_VISIBILITY_DEFAULT bool clingcon_set_minimize_bound(clingcon_theory_t *theory, int64_t bound);
+
 //! Obtain a symbol index which can be used to get the value of a symbol.
 //!
 //! Returns true if the symbol exists.
@@ -146,6 +155,68 @@ CLINGCON_VISIBILITY_DEFAULT bool clingcon_lookup_symbol(clingcon_theory_t *theor
 //! Does not throw.
 CLINGCON_VISIBILITY_DEFAULT clingo_symbol_t clingcon_get_symbol(clingcon_theory_t *theory, size_t index);
 
+//! Add a variable with the given name and obtain its symbol index.
+//!
+//! If the variable already exists, its index is returned.
+//! Variables and constraints must not be added while solving.
+CLINGCON_VISIBILITY_DEFAULT bool clingcon_add_variable(clingcon_theory_t *theory, clingo_symbol_t name,
+                                                       size_t *index);
+
+//! Add constraint `literal -> sum(coefficients[i]*variables[i]) <= rhs`.
+//!
+//! Variables are given by symbol indices and the literal is a program
+//! literal. If strict is true, the literal is equivalent to the constraint.
+//! The constraint is passed to the theory in the next initialization.
+CLINGCON_VISIBILITY_DEFAULT bool clingcon_add_sum(clingcon_theory_t *theory, clingo_literal_t literal,
+                                                  int const *coefficients, size_t const *variables, size_t size,
+                                                  int rhs, bool strict);
+
+//! Add constraint `literal -> distinct(coefficients[i]*variables[i]+constants[i])`.
+//!
+//! Variables are given by symbol indices and the literal is a program
+//! literal. The constraint is passed to the theory in the next
+//! initialization.
+CLINGCON_VISIBILITY_DEFAULT bool clingcon_add_distinct(clingcon_theory_t *theory, clingo_literal_t literal,
+                                                       int const *coefficients, size_t const *variables,
+                                                       int const *constants, size_t size);
+
+//! Obtain a program literal that is true iff the variable with the given
+//! symbol index is less than or equal to the given value.
+//!
+//! The literal is a fresh choice atom added via the backend of the control
+//! object and can be passed as an assumption when solving. It is linked to
+//! the corresponding order literal in the next initialization. Repeated
+//! calls with the same arguments return the same literal.
+//!
+//! Note that queries do not avoid re-initialization: the propagator is
+//! initialized again in the next solve call like in any other multi-shot
+//! step, even if the literal has been obtained before.
+CLINGCON_VISIBILITY_DEFAULT bool clingcon_get_bound_literal(clingcon_theory_t *theory, clingo_control_t *control,
+                                                            size_t variable, int value, clingo_literal_t *literal);
+
+//! Set a callback that is called on total assignments.
+//!
+//! The callback can inspect the assignment of the given thread using
+//! ::clingcon_assignment_get_value and add violated constraints using
+//! ::clingcon_add_lazy_sum.
+CLINGCON_VISIBILITY_DEFAULT bool clingcon_on_check(clingcon_theory_t *theory, clingcon_check_callback_t callback,
+                                                   void *data);
+
+//! Add constraint `sum(coefficients[i]*variables[i]) <= rhs` while solving.
+//!
+//! Variables are given by symbol indices. The constraint holds globally and
+//! is added to all threads. This function is thread-safe.
+CLINGCON_VISIBILITY_DEFAULT bool clingcon_add_lazy_sum(clingcon_theory_t *theory, int const *coefficients,
+                                                       size_t const *variables, size_t size, int rhs);
+
+//! Set the value the variable with the given symbol index should preferably
+//! take.
+//!
+//! Hints take effect in the next initialization. They determine the sign of
+//! order literals and guide the search if option `--order-heuristic=hint` is
+//! used.
+CLINGCON_VISIBILITY_DEFAULT bool clingcon_set_hint(clingcon_theory_t *theory, size_t variable, int value);
+
 //! Initialize index so that it can be used with clingcon_assignment_next.
 //!
 //! Does not throw.
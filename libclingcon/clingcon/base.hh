@@ -25,10 +25,12 @@
 #ifndef CLINGCON_BASE_H
 #define CLINGCON_BASE_H
 
+#include <algorithm>
 #include <clingo.hh>
 #include <forward_list>
 #include <math/wide_integer/uintwide_t.h>
 #include <optional>
+#include <tuple>
 
 //! @file clingcon/base.hh
 //! Basic data types.
@@ -45,8 +47,10 @@ using sum_t = int64_t;                       //!< type for summing up values
 using nsum_t = math::wide_integer::int128_t; //!< type for summing up values of nonlinear terms
 using co_var_t = std::pair<val_t, var_t>;    //!< coeffcient/variable pair
 using CoVarVec = std::vector<co_var_t>;
+using count_bound_t = std::tuple<val_t, val_t, val_t>; //!< value with lower and upper bound on its occurrences
+using CountBoundVec = std::vector<count_bound_t>;
 
-enum class Heuristic : val_t { None, MaxChain };
+enum class Heuristic : val_t { None, MaxChain, Hint, Objective };
 
 //! The maximum value for variables/coefficients in clingcon.
 //!
@@ -80,6 +84,14 @@ constexpr uint32_t DEFAULT_TRANSLATE_MINIMIZE{0};
 constexpr bool DEFAULT_CHECK_SOLUTION{true};
 constexpr bool DEFAULT_CHECK_STATE{false};
 constexpr bool DEFAULT_ADD_ORDER_CLAUSES{false};
+constexpr bool DEFAULT_LAZY_ATTACH{false};
+constexpr uint32_t DEFAULT_SUBSUM_LIMIT{0};
+constexpr double DEFAULT_PROBE_TIME{0};
+constexpr bool DEFAULT_TRANSLATE_PLAN{false};
+constexpr uint64_t DEFAULT_BUFFER_LIMIT{0};
+constexpr bool DEFAULT_TRANSLATE_MINIMIZE_LOG{false};
+constexpr bool DEFAULT_HINT_MODEL{false};
+constexpr bool DEFAULT_LOG_PLAN{false};
 
 constexpr lit_t TRUE_LIT{1}; //!< The true literal.
 constexpr var_t INVALID_VAR{std::numeric_limits<var_t>::max()};
@@ -111,6 +123,7 @@ struct SolverStatistics {
         refined_reason += stats.refined_reason;
         introduced_reason += stats.introduced_reason;
         literals += stats.literals;
+        attached += stats.attached;
     }
 
     double time_propagate{0};
@@ -119,6 +132,7 @@ struct SolverStatistics {
     uint64_t refined_reason{0};
     uint64_t introduced_reason{0};
     uint64_t literals{0};
+    uint64_t attached{0};
 };
 
 //! Propagator specific statistics.
@@ -137,6 +151,18 @@ struct Statistics {
         translate_clauses = 0;
         translate_wcs = 0;
         translate_literals = 0;
+        translate_normalized = 0;
+        translate_merged = 0;
+        translate_dominated = 0;
+        translate_redundant = 0;
+        translate_aliased = 0;
+        translate_subsums = 0;
+        translate_probed = 0;
+        translate_planned = 0;
+        translate_rejected = 0;
+        buffer_peak = 0;
+        translate_equal_hits = 0;
+        translate_skipped = 0;
         cost.reset();
         for (auto &s : solver_statistics) {
             s.reset();
@@ -157,6 +183,18 @@ struct Statistics {
         translate_clauses += stat.translate_clauses;
         translate_wcs += stat.translate_wcs;
         translate_literals += stat.translate_literals;
+        translate_normalized += stat.translate_normalized;
+        translate_merged += stat.translate_merged;
+        translate_dominated += stat.translate_dominated;
+        translate_redundant += stat.translate_redundant;
+        translate_aliased += stat.translate_aliased;
+        translate_subsums += stat.translate_subsums;
+        translate_probed += stat.translate_probed;
+        translate_planned += stat.translate_planned;
+        translate_rejected += stat.translate_rejected;
+        buffer_peak = std::max(buffer_peak, stat.buffer_peak);
+        translate_equal_hits += stat.translate_equal_hits;
+        translate_skipped += stat.translate_skipped;
         cost = stat.cost;
 
         auto it = solver_statistics.before_begin();
@@ -195,6 +233,18 @@ struct Statistics {
     uint64_t translate_clauses = 0;
     uint64_t translate_wcs = 0;
     uint64_t translate_literals = 0;
+    uint64_t translate_normalized = 0;
+    uint64_t translate_merged = 0;
+    uint64_t translate_dominated = 0;
+    uint64_t translate_redundant = 0;
+    uint64_t translate_aliased = 0;
+    uint64_t translate_subsums = 0;
+    uint64_t translate_probed = 0;
+    uint64_t translate_planned = 0;
+    uint64_t translate_rejected = 0;
+    uint64_t buffer_peak = 0;
+    uint64_t translate_equal_hits = 0;
+    uint64_t translate_skipped = 0;
     std::optional<sum_t> cost;
     std::forward_list<SolverStatistics> solver_statistics;
 };
@@ -239,6 +289,14 @@ struct Config {
     bool add_order_clauses{DEFAULT_ADD_ORDER_CLAUSES};
     bool check_solution{DEFAULT_CHECK_SOLUTION};
     bool check_state{DEFAULT_CHECK_STATE};
+    bool lazy_attach{DEFAULT_LAZY_ATTACH};
+    uint32_t subsum_limit{DEFAULT_SUBSUM_LIMIT};
+    double probe_time{DEFAULT_PROBE_TIME};
+    bool translate_plan{DEFAULT_TRANSLATE_PLAN};
+    uint64_t buffer_limit{DEFAULT_BUFFER_LIMIT};
+    bool translate_minimize_log{DEFAULT_TRANSLATE_MINIMIZE_LOG};
+    bool hint_model{DEFAULT_HINT_MODEL};
+    bool log_plan{DEFAULT_LOG_PLAN};
 };
 
 //! Class to add solver literals, create clauses, and access the current
@@ -282,7 +340,13 @@ class InitClauseCreator final : public AbstractClauseCreator {
         std::tuple<lit_t, std::vector<Clingo::WeightedLiteral>, val_t, Clingo::WeightConstraintType>;
     using MinimizeLiteral = std::tuple<lit_t, val_t, int>;
 
-    InitClauseCreator(Clingo::PropagateInit &init, Statistics &stats) : init_{init}, stats_{stats} {}
+    //! Create a clause creator that passes buffered clauses to clingo once
+    //! their size reaches the given limit (see InitClauseCreator::flush).
+    //!
+    //! A limit of zero buffers all constraints until InitClauseCreator::commit
+    //! is called.
+    InitClauseCreator(Clingo::PropagateInit &init, Statistics &stats, uint64_t limit = 0)
+        : init_{init}, stats_{stats}, limit_{limit} {}
 
     InitClauseCreator(InitClauseCreator &&) = delete;
     InitClauseCreator(InitClauseCreator const &) = delete;
@@ -293,6 +357,8 @@ class InitClauseCreator final : public AbstractClauseCreator {
 
     //! Get the propagator statistics.
     [[nodiscard]] auto statistics() const -> Statistics const & { return stats_; }
+    //! Get the propagator statistics.
+    [[nodiscard]] auto statistics() -> Statistics & { return stats_; }
 
     [[nodiscard]] auto add_literal() -> lit_t override {
         auto lit = init_.add_literal();
@@ -322,6 +388,7 @@ class InitClauseCreator final : public AbstractClauseCreator {
         }
         clauses_.emplace_back(0);
 
+        buffer_(clause.size() + 1);
         return true;
     }
 
@@ -353,24 +420,70 @@ class InitClauseCreator final : public AbstractClauseCreator {
         }
         weight_constraints_.emplace_back(lit, std::vector<Clingo::WeightedLiteral>{wlits.begin(), wlits.end()}, bound,
                                          type);
+        buffer_(wlits.size() + 1);
         return true;
     }
 
     //! Add a literal to the objective function.
     void add_minimize(lit_t lit, val_t weight, int level) { minimize_.emplace_back(lit, weight, level); }
 
+    //! Pass buffered clauses to clingo if their size reached the limit.
+    //!
+    //! This function is meant to be called between translating constraints.
+    //! Clauses that are unit under the current assignment and weight
+    //! constraints are kept until InitClauseCreator::commit is called because
+    //! clingo might propagate them right away. Thus, flushing does not change
+    //! the assignment.
+    [[nodiscard]] auto flush() -> bool { return limit_ == 0 || buffered_ < limit_ || flush_(false); }
+
     //! Commit accumulated constraints.
     [[nodiscard]] auto commit() -> bool {
-        for (auto it = clauses_.begin(), ie = clauses_.end(); it != ie; ++it) {
+        if (!flush_(true)) {
+            return false;
+        }
+        clauses_ = Clause();
+        weight_constraints_ = std::vector<WeightConstraint>();
+        return true;
+    }
+
+  private:
+    //! Account for a buffered constraint of the given size.
+    void buffer_(uint64_t size) {
+        buffered_ += size;
+        stats_.buffer_peak = std::max(stats_.buffer_peak, buffered_);
+    }
+
+    //! Pass accumulated constraints to clingo keeping allocated buffers.
+    //!
+    //! Unless all constraints are passed, only clauses with at least two
+    //! unassigned or true literals are passed.
+    [[nodiscard]] auto flush_(bool all) -> bool {
+        auto ass = init_.assignment();
+        auto out = clauses_.begin() + static_cast<ptrdiff_t>(all ? 0 : kept_);
+        for (auto it = out, ie = clauses_.end(); it != ie; ++it) {
             auto ib = it;
-            while (*it != 0) {
-                ++it;
+            int open = 0;
+            for (; *it != 0; ++it) {
+                if (!ass.is_false(*it)) {
+                    ++open;
+                }
             }
-            if (!init_.add_clause(Clingo::LiteralSpan{&*ib, &*it})) {
+            if (!all && open < 2) {
+                // move the clause to the kept clauses at the front
+                for (; ib != it; ++ib) {
+                    *out++ = *ib;
+                }
+                *out++ = 0;
+            } else if (!init_.add_clause(Clingo::LiteralSpan{&*ib, &*it})) {
                 return false;
             }
         }
-        clauses_ = Clause();
+        kept_ = static_cast<size_t>(out - clauses_.begin());
+        clauses_.resize(kept_);
+        buffered_ = 0;
+        if (!all) {
+            return true;
+        }
 
         for (auto const &[lit, wlits, bound, type] : weight_constraints_) {
             auto inv = static_cast<Clingo::WeightConstraintType>(-type);
@@ -388,10 +501,12 @@ class InitClauseCreator final : public AbstractClauseCreator {
         return true;
     }
 
-  private:
     InitState state_{InitState::Init};
     Clingo::PropagateInit &init_;
     Statistics &stats_;
+    uint64_t limit_;
+    uint64_t buffered_{0};
+    size_t kept_{0};
     Clause clauses_;
     std::vector<WeightConstraint> weight_constraints_;
     std::vector<MinimizeLiteral> minimize_;
@@ -152,6 +152,99 @@ class NonlinearConstraint final : public AbstractConstraint {
     var_t var_z_;
 };
 
+//! Class to capture constraints of form `x = max(a_0*x_0, ..., a_n*x_n)`.
+//!
+//! Minimum and absolute value terms are expressed using this constraint.
+class MaxConstraint final : public AbstractConstraint {
+  public:
+    MaxConstraint() = delete;
+    MaxConstraint(MaxConstraint const &) = delete;
+    MaxConstraint(MaxConstraint &&) = delete;
+    auto operator=(MaxConstraint const &) -> MaxConstraint & = delete;
+    auto operator=(MaxConstraint &&) -> MaxConstraint & = delete;
+    ~MaxConstraint() override = default;
+
+    //! Create a new max constraint.
+    [[nodiscard]] static auto create(lit_t lit, var_t var, CoVarVec const &elems) -> std::unique_ptr<MaxConstraint> {
+        auto size = sizeof(MaxConstraint) + elems.size() * sizeof(std::pair<val_t, var_t>);
+        return std::unique_ptr<MaxConstraint>{new (operator new(size)) MaxConstraint(lit, var, elems)};
+    }
+
+    //! Create thread specific state for the constraint.
+    [[nodiscard]] auto create_state() -> UniqueConstraintState override;
+
+    //! Get the literal associated with the constraint.
+    [[nodiscard]] auto literal() const -> lit_t override { return lit_; }
+
+    //! Get the variable holding the maximum.
+    [[nodiscard]] auto var() const -> var_t { return var_; }
+
+    //! Get the number of elements in the constraint.
+    [[nodiscard]] auto size() const -> size_t { return size_; }
+
+    //! Access the i-th element.
+    [[nodiscard]] auto operator[](size_t i) const -> std::pair<val_t, var_t> { return elements_[i]; }
+
+    //! Pointer to the first element of the constraint.
+    [[nodiscard]] auto begin() const -> std::pair<val_t, var_t> const * { return elements_; }
+
+    //! Pointer after the last element of the constraint.
+    [[nodiscard]] auto end() const -> std::pair<val_t, var_t> const * {
+        return elements_ + size_; // NOLINT
+    }
+
+  private:
+    MaxConstraint(lit_t lit, var_t var, CoVarVec const &elems) : lit_{lit}, var_{var}, size_{elems.size()} {
+        std::copy(elems.begin(), elems.end(), elements_);
+    }
+
+    //! Solver literal associated with the constraint.
+    lit_t lit_;
+    //! Variable holding the maximum.
+    var_t var_;
+    //! Number of elements in the constraint.
+    size_t size_;
+    //! List of integer/string pairs representing coefficient and variable.
+    std::pair<val_t, var_t> elements_[]; // NOLINT
+};
+
+//! Class to capture constraints of form `z = x / y`.
+//!
+//! The division truncates toward zero and the divisor must not be zero.
+class DivConstraint final : public AbstractConstraint {
+  public:
+    DivConstraint(lit_t lit, var_t var_x, var_t var_y, var_t var_z)
+        : lit_{lit}, var_x_{var_x}, var_y_{var_y}, var_z_{var_z} {}
+    DivConstraint() = delete;
+    DivConstraint(DivConstraint const &) = delete;
+    DivConstraint(DivConstraint &&) = delete;
+    auto operator=(DivConstraint const &) -> DivConstraint & = delete;
+    auto operator=(DivConstraint &&) -> DivConstraint & = delete;
+    ~DivConstraint() override = default;
+
+    //! Create thread specific state for the constraint.
+    [[nodiscard]] auto create_state() -> UniqueConstraintState override;
+
+    //! Get the literal associated with the constraint.
+    [[nodiscard]] auto literal() const -> lit_t override { return lit_; }
+    //! Get the dividend.
+    [[nodiscard]] auto var_x() const -> var_t { return var_x_; }
+    //! Get the divisor.
+    [[nodiscard]] auto var_y() const -> var_t { return var_y_; }
+    //! Get the quotient.
+    [[nodiscard]] auto var_z() const -> var_t { return var_z_; }
+
+  private:
+    //! Solver literal associated with the constraint.
+    lit_t lit_;
+    //! Variable holding the dividend.
+    var_t var_x_;
+    //! Variable holding the divisor.
+    var_t var_y_;
+    //! Variable holding the quotient.
+    var_t var_z_;
+};
+
 //! Class to capture minimize constraints of form `a_0*x_0 + ... + a_n * x_n + adjust`.
 class MinimizeConstraint final : public AbstractConstraint {
   public:
@@ -294,6 +387,70 @@ class DistinctConstraint final : public AbstractConstraint {
     DistinctElement elements_[]; // NOLINT
 };
 
+//! Class to capture count and global cardinality constraints.
+//!
+//! Each bound `(v, l, u)` requires that between `l` and `u` terms of the
+//! constraint take value `v`. The terms are stored in the same way as the
+//! terms of a distinct constraint.
+class CountConstraint final : public AbstractConstraint {
+  public:
+    using Elements = DistinctConstraint::Elements;
+
+    //! Create a new count constraint.
+    [[nodiscard]] static auto create(lit_t lit, Elements const &elements, CountBoundVec const &bounds, bool sort)
+        -> std::unique_ptr<CountConstraint>;
+
+    CountConstraint() = delete;
+    CountConstraint(CountConstraint &) = delete;
+    CountConstraint(CountConstraint &&) = delete;
+    auto operator=(CountConstraint const &) -> CountConstraint & = delete;
+    auto operator=(CountConstraint &&) -> CountConstraint & = delete;
+    ~CountConstraint() override = default;
+
+    //! Create thread specific state for the constraint.
+    [[nodiscard]] auto create_state() -> UniqueConstraintState override;
+
+    //! Get the literal associated with the constraint.
+    [[nodiscard]] auto literal() const -> lit_t override { return lit_; }
+
+    //! Get the number of elements in the constraint.
+    [[nodiscard]] auto size() const -> size_t { return size_; }
+
+    //! Access the i-th element.
+    [[nodiscard]] auto operator[](size_t i) const -> DistinctElement const & {
+        return elements_[i]; // NOLINT
+    }
+
+    //! Pointer to the first element of the constraint.
+    [[nodiscard]] auto begin() const -> DistinctElement const * { return elements_; }
+
+    //! Pointer after the last element of the constraint.
+    [[nodiscard]] auto end() const -> DistinctElement const * {
+        return elements_ + size_; // NOLINT
+    }
+
+    //! Get the number of bounds of the constraint.
+    [[nodiscard]] auto num_bounds() const -> size_t { return num_bounds_; }
+
+    //! Access the i-th bound.
+    [[nodiscard]] auto bound(size_t i) const -> count_bound_t const & {
+        return reinterpret_cast<count_bound_t const *>(elements_ + size_)[i]; // NOLINT
+    }
+
+  private:
+    CountConstraint(lit_t lit, Elements const &elements, CountBoundVec const &bounds, bool sort);
+
+    //! Solver literal associated with the constraint.
+    lit_t lit_;
+    //! The elements of the count constraint.
+    uint32_t size_;
+    //! The number of bounds of the count constraint.
+    uint32_t num_bounds_;
+    //! List of terms followed by the bounds and the coefficient/variable
+    //! pairs of the terms.
+    DistinctElement elements_[]; // NOLINT
+};
+
 //! Class to capture disjoint constraints.
 class DisjointConstraint final : public AbstractConstraint {
   public:
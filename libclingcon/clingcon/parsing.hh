@@ -41,6 +41,7 @@ constexpr char const *THEORY = R"(
     var_term  { };
     sum_term {
     -  : 3, unary;
+    @  : 3, unary;
     ** : 2, binary, right;
     *  : 1, binary, left;
     /  : 1, binary, left;
@@ -68,6 +69,17 @@ constexpr char const *THEORY = R"(
     -  : 1, binary, left;
     @  : 0, binary, left
     };
+    gcc_term {
+    -  : 5, unary;
+    ** : 4, binary, right;
+    *  : 3, binary, left;
+    /  : 3, binary, left;
+    \  : 3, binary, left;
+    +  : 2, binary, left;
+    -  : 2, binary, left;
+    .. : 1, binary, left;
+    @  : 0, binary, left
+    };
     &__diff_h/0 : sum_term, {<=}, sum_term, any;
     &__diff_b/0 : sum_term, {<=}, sum_term, any;
     &__sum_h/0 : sum_term, {<=,=,!=,<,>,>=}, sum_term, any;
@@ -78,6 +90,8 @@ constexpr char const *THEORY = R"(
     &maximize/0 : sum_term, directive;
     &show/0 : sum_term, directive;
     &distinct/0 : sum_term, head;
+    &count/1 : sum_term, {<=,=,!=,<,>,>=}, sum_term, head;
+    &gcc/0 : gcc_term, head;
     &disjoint/0 : disjoint_term, head;
     &dom/0 : dom_term, {=}, var_term, head
 }.
@@ -119,6 +133,20 @@ class AbstractConstraintBuilder {
     //! Add a distinct constraint.
     [[nodiscard]] virtual auto add_distinct(lit_t lit, std::vector<std::pair<CoVarVec, val_t>> const &elems)
         -> bool = 0;
+    //! Add a count constraint where each bound restricts how often a value
+    //! is taken by the terms.
+    [[nodiscard]] virtual auto add_count(lit_t lit, std::vector<std::pair<CoVarVec, val_t>> const &elems,
+                                         CountBoundVec const &bounds) -> bool = 0;
+    //! Get a variable holding the maximum of the given terms.
+    [[nodiscard]] virtual auto add_max(std::vector<std::pair<CoVarVec, val_t>> const &elems) -> var_t = 0;
+    //! Get a variable holding the product of the given variables.
+    [[nodiscard]] virtual auto add_mul(var_t var_a, var_t var_b) -> var_t = 0;
+    //! Get a variable holding the quotient of the given terms.
+    [[nodiscard]] virtual auto add_div(std::pair<CoVarVec, val_t> const &x, std::pair<CoVarVec, val_t> const &y)
+        -> var_t = 0;
+    //! Get a variable holding the remainder of the division of the given terms.
+    [[nodiscard]] virtual auto add_mod(std::pair<CoVarVec, val_t> const &x, std::pair<CoVarVec, val_t> const &y)
+        -> var_t = 0;
     //! Add a disjoint constraint.
     [[nodiscard]] virtual auto add_disjoint(lit_t lit, CoVarVec const &elems) -> bool = 0;
     //! Add a domain for the given variable.
@@ -29,6 +29,8 @@
 #include <clingcon/solver.hh>
 
 #include <atomic>
+#include <functional>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -41,6 +43,8 @@ namespace Clingcon {
 
 using UniqueMinimizeConstraint = std::unique_ptr<MinimizeConstraint>;
 
+class AbstractConstraintBuilder;
+
 //! A propagator for CSP constraints.
 class Propagator final : public Clingo::Heuristic {
   public:
@@ -48,6 +52,11 @@ class Propagator final : public Clingo::Heuristic {
     using SymMap = std::unordered_map<Clingo::Symbol, var_t>;
     using VarSet = std::unordered_set<var_t>;
     using SigSet = std::unordered_set<Clingo::Signature>;
+    using AliasMap = std::unordered_map<var_t, std::tuple<val_t, var_t, val_t>>;
+    using SumQueue = std::vector<std::tuple<lit_t, CoVarVec, val_t, bool>>;
+    using DistinctQueue = std::vector<std::pair<lit_t, std::vector<std::pair<CoVarVec, val_t>>>>;
+    using CheckCallback = std::function<void(uint32_t)>;
+    using HintMap = std::unordered_map<var_t, val_t>;
 
     Propagator() = default;
     Propagator(Propagator const &) = delete;
@@ -70,6 +79,33 @@ class Propagator final : public Clingo::Heuristic {
     //! Add a variable to the program.
     auto add_variable(Clingo::Symbol sym) -> var_t;
 
+    //! Add an auxiliary variable without a name to the program.
+    //!
+    //! Such variables are not part of models and their domain is not
+    //! restricted by the configured integer range.
+    auto add_variable() -> var_t;
+
+    //! Add an auxiliary variable with the given bounds.
+    auto add_variable(val_t min_int, val_t max_int) -> var_t;
+
+    //! Get the number of variables.
+    [[nodiscard]] auto num_variables() -> var_t { return master_().num_variables(); }
+
+    //! Get the bounds of a variable in the master solver.
+    [[nodiscard]] auto get_bounds(var_t var) -> std::pair<val_t, val_t>;
+
+    //! Get the bounds of variables in the master solver that are restricted
+    //! by facts added during initialization.
+    [[nodiscard]] auto get_fact_bounds() -> std::unordered_map<var_t, std::pair<val_t, val_t>>;
+
+    //! Represent variable `var` by `co*other+fixed`, where `co` is either 1
+    //! or -1.
+    //!
+    //! The variable must not occur in any constraint. Its domain is imposed
+    //! on the other variable. Aliases are dropped again at the beginning of
+    //! the next solving step.
+    [[nodiscard]] auto add_alias(AbstractClauseCreator &cc, var_t var, val_t co, var_t other, val_t fixed) -> bool;
+
     //! Enable show statement.
     //!
     //! If the show statement has not been enabled, then all variables are
@@ -93,6 +129,39 @@ class Propagator final : public Clingo::Heuristic {
     //! Add a constraint to the program.
     void add_constraint(UniqueConstraint constraint);
 
+    //! Queue constraint `lit -> elems <= rhs` where `lit` is a program
+    //! literal.
+    //!
+    //! If `strict` is true, the literal is equivalent to the constraint.
+    //! Queued constraints are passed to the constraint builder in the next
+    //! call to Propagator::init.
+    void queue_sum(lit_t lit, CoVarVec elems, val_t rhs, bool strict);
+
+    //! Queue a distinct constraint over the given terms where `lit` is a
+    //! program literal.
+    void queue_distinct(lit_t lit, std::vector<std::pair<CoVarVec, val_t>> elems);
+
+    //! Set a callback that is called with the thread id on total
+    //! assignments.
+    //!
+    //! The callback can inspect the assignment using Propagator::get_value
+    //! and add violated constraints using Propagator::add_lazy_sum.
+    void on_check(CheckCallback callback) { check_callback_ = std::move(callback); }
+
+    //! Add constraint `elems <= rhs` while solving.
+    //!
+    //! The constraint holds globally and is added to the solvers of all
+    //! threads in their next check. Afterward, it is kept like any other
+    //! constraint. This function is thread-safe.
+    void add_lazy_sum(CoVarVec elems, val_t rhs);
+
+    //! Set the value the given variable should preferably take.
+    //!
+    //! Hints are passed to the solvers in the next call to Propagator::init.
+    //! They determine the sign of order literals and are followed by the hint
+    //! heuristic.
+    void set_hint(var_t var, val_t value) { hints_.insert_or_assign(var, value); }
+
     //! Initializes the propagator extracting constraints from the theory data.
     //!
     //! The function handles reinitialization for multi-shot solving and
@@ -146,6 +215,12 @@ class Propagator final : public Clingo::Heuristic {
     //! Set the `bound` of the minimize constraint.
     void update_minimize(sum_t bound);
 
+    //! Set the `bound` of the minimize constraint for the next solve step.
+    //!
+    //! Only models with a cost less than or equal to the bound are accepted.
+    //! The bound is reset in the next call to Propagator::init.
+    void set_minimize_bound(sum_t bound) { initial_bound_ = bound; }
+
     //! Removes the minimize constraint from the lookup lists.
     auto remove_minimize() -> UniqueMinimizeConstraint;
 
@@ -177,6 +252,13 @@ class Propagator final : public Clingo::Heuristic {
     //! master solver.
     void add_constraint_(UniqueConstraint constraint);
 
+    //! Pass the queued constraints to the given builder.
+    [[nodiscard]] auto add_queued_(AbstractConstraintBuilder &builder) -> bool;
+
+    //! Pass constraints added while solving to the solver of the given
+    //! thread.
+    void integrate_lazy_(Solver &solver, uint32_t thread_id);
+
     //! Propagate constraints refining bounds.
     auto simplify_(AbstractClauseCreator &cc) -> bool;
 
@@ -205,8 +287,18 @@ class Propagator final : public Clingo::Heuristic {
     Statistics stats_accu_;                       //!< accumulated statistics
     VarSet show_variable_;                        //!< variables to show
     SigSet show_signature_;                       //!< signatures to show
+    AliasMap aliases_;                            //!< map from aliased variables to their representation
+    SumQueue queued_sums_;                        //!< queued sum constraints
+    DistinctQueue queued_distinct_;               //!< queued distinct constraints
+    CheckCallback check_callback_;                //!< callback for total assignments
+    ConstraintVec lazy_constraints_;              //!< constraints added while solving
+    std::vector<size_t> lazy_offsets_;            //!< number of lazy constraints passed to each solver
+    std::atomic<size_t> lazy_size_{0};            //!< number of lazy constraints
+    std::mutex lazy_mutex_;                       //!< mutex protecting lazy constraints
+    HintMap hints_;                               //!< preferred values of variables
     MinimizeConstraint *minimize_{nullptr};       //!< minimize constraint
     std::atomic<sum_t> minimize_bound_{no_bound}; //!< bound of the minimize constraint
+    sum_t initial_bound_{no_bound};               //!< bound of the minimize constraint for the next step
     bool show_{false};                            //!< whether there is a show statement
 };
 
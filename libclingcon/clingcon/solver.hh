@@ -29,6 +29,7 @@
 #include <clingcon/util.hh>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 
 //! @file clingcon/solver.hh
 //! This module implements a CSP solver for thread-specific propagation and
@@ -46,6 +47,9 @@ using ConstraintVec = std::vector<UniqueConstraint>;
 using UniqueConstraintState = std::unique_ptr<AbstractConstraintState>;
 
 constexpr val_t MOGRIFY_FACTOR = 10;
+//! The objective heuristic overrides decisions on literals other than order
+//! literals only for elements with larger absolute coefficients.
+constexpr val_t OBJECTIVE_THRESHOLD = 1;
 
 //! Base class of all constraints.
 class AbstractConstraint {
@@ -84,9 +88,23 @@ class AbstractConstraintState {
     virtual void attach(Solver &solver) = 0;
     //! Detach the constraint from a solver.
     virtual void detach(Solver &solver) = 0;
+    //! Returns true if the constraint can be kept detached while its literal
+    //! is not true.
+    [[nodiscard]] virtual auto detachable() const -> bool { return false; }
     //! Translate a constraint to simpler constraints.
     [[nodiscard]] virtual auto translate(Config const &config, Solver &solver, InitClauseCreator &cc,
                                          ConstraintVec &added) -> std::pair<bool, bool> = 0;
+    //! Estimate the number of clauses needed to translate the constraint and
+    //! the cost of propagating it instead.
+    //!
+    //! Returns nothing if the constraint would not be translated to clauses.
+    [[nodiscard]] virtual auto translation_estimate(Config const &config, Solver &solver, InitClauseCreator &cc)
+        -> std::optional<std::pair<uint64_t, double>> {
+        static_cast<void>(config);
+        static_cast<void>(solver);
+        static_cast<void>(cc);
+        return std::nullopt;
+    }
     //! Copy the constraint state (for another solver)
     [[nodiscard]] virtual auto copy() const -> UniqueConstraintState = 0;
 
@@ -623,6 +641,14 @@ class Solver {
     //! for the given value.
     [[nodiscard]] auto get_literal(AbstractClauseCreator &cc, VarState &vs, val_t value) -> lit_t;
 
+    //! Get a literal that is true iff the given variable is equal to the
+    //! given value.
+    //!
+    //! Literals are introduced during translation and cached so that they can
+    //! be shared among constraints. The first element of the returned pair is
+    //! false if adding clauses failed.
+    [[nodiscard]] auto get_equal_literal(InitClauseCreator &cc, VarState &vs, val_t value) -> std::pair<bool, lit_t>;
+
     //! This function is an extended version of Solver::get_literal that can
     //! assign a fact literal if the value did not have a literal before.
     [[nodiscard]] auto update_literal(AbstractClauseCreator &cc, VarState &vs, val_t value, Clingo::TruthValue truth)
@@ -660,7 +686,8 @@ class Solver {
     //!
     //! This function removes all solve step local variables from the state, maps
     //! fixed global literals to the true/false literal, and resets the minimize
-    //! constraint.
+    //! constraint. Only order literals added since the last call to
+    //! Solver::mark_variables are inspected.
     void update();
 
     //! Integrate the lower and upper bounds from State `other`.
@@ -669,6 +696,9 @@ class Solver {
     //! This can lead to a conflict if states have conflicting lower/upper
     //! bounds.
     //!
+    //! Only variables whose bounds changed on the top level in `other` since
+    //! the last call to Solver::mark_variables are inspected.
+    //!
     //! Precondition: update should be called before this function to really
     //! integrate all bounds.
     [[nodiscard]] auto update_bounds(AbstractClauseCreator &cc, Solver &other, bool check_state) -> bool;
@@ -676,6 +706,21 @@ class Solver {
     //! Adds a new VarState object and returns its index;
     [[nodiscard]] auto add_variable(val_t min_int, val_t max_int) -> var_t;
 
+    //! Get the bounds of variables restricted by facts that have not been
+    //! propagated yet.
+    //!
+    //! Only such variables are contained in the returned map.
+    [[nodiscard]] auto fact_bounds() const -> std::unordered_map<var_t, std::pair<val_t, val_t>>;
+
+    //! Get the number of variables.
+    [[nodiscard]] auto num_variables() const -> var_t { return static_cast<var_t>(var2vs_.size()); }
+
+    //! Mark a variable as aliased.
+    //!
+    //! Aliased variables are represented by other variables. They do not
+    //! occur in constraints and are not split on total assignments.
+    void alias_variable(var_t var, bool aliased);
+
     //! Integrates the given domain for varibale var.
     //!
     //! Consider x in {[1,3), [4,6), [7,9)}. We can simply add the binary
@@ -699,11 +744,36 @@ class Solver {
         -> bool;
 
     //! Add the given constraint to the propagation queue and initialize its state.
+    //!
+    //! States created by Solver::plan_translation_ are attached here.
     auto add_constraint(AbstractConstraint &constraint) -> AbstractConstraintState &;
 
     //! Remove a constraint.
     void remove_constraint(AbstractConstraint &constraint);
 
+    //! Add a constraint while solving.
+    //!
+    //! The constraint is added in the next call to Solver::check, which then
+    //! also propagates on decision levels that have not been propagated.
+    void add_lazy_constraint(AbstractConstraint &constraint) { lazy_.emplace_back(&constraint); }
+
+    //! Check if there are constraints added while solving that have not been
+    //! added yet.
+    [[nodiscard]] auto has_lazy_constraints() const -> bool { return !lazy_.empty(); }
+
+    //! Set the value the given variable should preferably take.
+    //!
+    //! Hints determine the sign of order literals introduced afterward and are
+    //! followed by the hint heuristic.
+    void set_hint(var_t var, val_t value) { hints_.insert_or_assign(var, value); }
+
+    //! Remove all hints.
+    void clear_hints() { hints_.clear(); }
+
+    //! Set the elements of the minimize constraint followed by the objective
+    //! heuristic.
+    void set_objective(CoVarVec objective);
+
     //! Simplify the state using fixed literals in the trail up to the given
     //! offset and the enqued constraints in the todo list.
     //!
@@ -717,6 +787,17 @@ class Solver {
     //! This functions removes translated constraints from the map and the
     //! state. Constraints added during the translation have to be added to the
     //! propagator as well.
+    //!
+    //! If translation planning is enabled, only the constraints selected by
+    //! Solver::plan_translation_ are translated to clauses.
+    //!
+    //! Constraints kept in a previous solve step are skipped unless the bounds
+    //! of their variables or the truth value of their literal changed.
+    //!
+    //! If lazy attachment is enabled, detachable constraints whose literal is
+    //! not yet true are detached afterward. They are attached again in
+    //! Solver::check once their literal becomes true and detached when
+    //! backtracking below that level.
     auto translate(InitClauseCreator &cc, Statistics &stats, Config const &conf, ConstraintVec &constraints) -> bool;
 
     //! Enable translation of minimize constraint.
@@ -747,6 +828,8 @@ class Solver {
     void mark_variables(var_t var) {
         assert(max_static_var_ <= var);
         max_static_var_ = var;
+        step_literals_.clear();
+        root_changed_.clear();
     }
 
     //! @}
@@ -780,6 +863,22 @@ class Solver {
     //! @}
 
   private:
+    //! Select the constraints to translate to clauses within the total clause
+    //! limit.
+    //!
+    //! Candidates are ordered by their propagation cost per estimated clause
+    //! and selected greedily. The states of new constraints are created but
+    //! not attached.
+    auto plan_translation_(InitClauseCreator &cc, Statistics &stats, Config const &conf, ConstraintVec &constraints)
+        -> std::unordered_set<AbstractConstraintState *>;
+    //! Get the state of the given constraint creating a detached one if it
+    //! does not exist yet.
+    auto add_detached_(AbstractConstraint &constraint) -> AbstractConstraintState &;
+    //! Check if the constraint has been kept by a previous translation and
+    //! neither the bounds of its variables nor the truth value of its literal
+    //! changed since.
+    [[nodiscard]] auto unchanged_(AbstractConstraintState &cs, Clingo::TruthValue truth) const -> bool;
+
     //! Update preceeding and succeeding literals of order literal with the
     //! given value.
     auto update_litmap_(VarState &vs, lit_t lit, val_t value) -> std::pair<lit_t, lit_t>;
@@ -869,10 +968,44 @@ class Solver {
     //! List of variable/coefficient/constraint triples that have been removed
     //! from the Solver::v2cs_ map.
     std::vector<std::tuple<var_t, val_t, AbstractConstraintState *>> removed_var_watches_;
+    //! List of constraint states that have been attached lazily on a decision
+    //! level above zero.
+    std::vector<AbstractConstraintState *> attached_;
+    //! Set of constraint states that stay detached until their literal
+    //! becomes true.
+    std::unordered_set<AbstractConstraintState *> detached_;
+    //! Set of constraints whose states have been attached lazily at least
+    //! once. It is used to count each constraint only once in the statistics.
+    std::unordered_set<AbstractConstraint *> ever_attached_;
+    //! Set of aliased variables.
+    std::unordered_set<var_t> aliased_;
+    //! Map from variable/value pairs to literals that are true iff the
+    //! variable takes the value.
+    std::map<std::pair<var_t, val_t>, lit_t> equal_literals_;
+    //! Map from constraint states kept by Solver::translate to the truth value
+    //! their literal had at that time.
+    std::unordered_map<AbstractConstraintState *, Clingo::TruthValue> translated_;
+    //! Order literals added to the litmap since the last call to
+    //! Solver::mark_variables.
+    std::vector<lit_t> step_literals_;
+    //! Variables whose bounds changed on the top level since the last call to
+    //! Solver::mark_variables.
+    std::unordered_set<var_t> root_changed_;
+    //! Constraints added while solving that have not been added yet.
+    std::vector<AbstractConstraint *> lazy_;
+    //! Preferred values of variables.
+    std::unordered_map<var_t, val_t> hints_;
+    //! Elements of the minimize constraint sorted by decreasing absolute
+    //! coefficients.
+    CoVarVec objective_;
     //! Reason vector to avoid unnecessary allocations.
     std::vector<lit_t> temp_reason_;
     //! Offset to speed up Solver::check_full.
     uint32_t split_last_{0};
+    //! Offset to speed up the objective heuristic in Solver::decide.
+    //!
+    //! All variables of elements before the offset are assigned.
+    uint32_t objective_last_{0};
     //! Offset to speed up Solver::simplify.
     uint32_t trail_offset_{0};
     //! Current bound of the minimize constraint (if any).
@@ -56,6 +56,7 @@ struct clingcon_theory {
     Propagator propagator;
     Clingo::Detail::ParserList parsers;
     std::map<std::pair<Target, std::optional<uint32_t>>, val_t> deferred;
+    std::map<std::pair<var_t, val_t>, clingo_literal_t> bound_literals;
     bool shift_constraints{true};
 };
 
@@ -110,6 +111,12 @@ auto heuristic_str(Heuristic heu) -> char const * {
             return "max-chain";
             break;
         }
+        case Heuristic::Hint: {
+            return "hint";
+        }
+        case Heuristic::Objective: {
+            return "objective";
+        }
     };
     return "";
 }
@@ -278,6 +285,12 @@ void set_value(Target target, Config &config, std::pair<val_t, std::optional<uin
     if (std::strncmp(value, "max-chain", comma - value) == 0) {
         return {static_cast<val_t>(Heuristic::MaxChain), thread};
     }
+    if (std::strncmp(value, "hint", comma - value) == 0) {
+        return {static_cast<val_t>(Heuristic::Hint), thread};
+    }
+    if (std::strncmp(value, "objective", comma - value) == 0) {
+        return {static_cast<val_t>(Heuristic::Objective), thread};
+    }
     throw std::invalid_argument("invalid argument");
 }
 
@@ -315,6 +328,22 @@ template <class T, class U>
     };
 }
 
+//! Convert the given arrays of coefficients and symbol indices into a list
+//! of elements checking that the coefficients are in the supported range.
+[[nodiscard]] auto make_elems(Propagator &propagator, int const *coefficients, size_t const *variables, size_t size)
+    -> CoVarVec {
+    CoVarVec elems;
+    elems.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        auto index = variables[i]; // NOLINT
+        if (index == 0 || index > propagator.num_variables()) {
+            throw std::invalid_argument("invalid variable index");
+        }
+        elems.emplace_back(check_valid_value(coefficients[i]), static_cast<var_t>(index - 1)); // NOLINT
+    }
+    return elems;
+}
+
 } // namespace
 
 extern "C" auto clingcon_create(clingcon_theory_t **theory) -> bool {
@@ -411,6 +440,20 @@ extern "C" auto clingcon_configure(clingcon_theory_t *theory, char const *key, c
             config.translate_minimize = parse_num<uint32_t>(value);
         } else if (std::strcmp(key, "add-order-clauses") == 0) {
             config.add_order_clauses = parse_bool(value);
+        } else if (std::strcmp(key, "lazy-attach") == 0) {
+            config.lazy_attach = parse_bool(value);
+        } else if (std::strcmp(key, "subsum-limit") == 0) {
+            config.subsum_limit = parse_num<uint32_t>(value);
+        } else if (std::strcmp(key, "probe-time") == 0) {
+            config.probe_time = parse_num<double>(value);
+        } else if (std::strcmp(key, "translate-plan") == 0) {
+            config.translate_plan = parse_bool(value);
+        } else if (std::strcmp(key, "buffer-limit") == 0) {
+            config.buffer_limit = parse_num<uint64_t>(value);
+        } else if (std::strcmp(key, "translate-opt-log") == 0) {
+            config.translate_minimize_log = parse_bool(value);
+        } else if (std::strcmp(key, "hint-model") == 0) {
+            config.hint_model = parse_bool(value);
         }
         // hidden/debug
         else if (std::strcmp(key, "min-int") == 0) {
@@ -421,6 +464,8 @@ extern "C" auto clingcon_configure(clingcon_theory_t *theory, char const *key, c
             config.check_solution = parse_bool(value);
         } else if (std::strcmp(key, "check-state") == 0) {
             config.check_state = parse_bool(value);
+        } else if (std::strcmp(key, "log-plan") == 0) {
+            config.log_plan = parse_bool(value);
         }
         // propagation
         else if (std::strcmp(key, "order-heuristic") == 0) {
@@ -484,23 +529,58 @@ extern "C" auto clingcon_register_options(clingcon_theory_t *theory, clingo_opti
                         "        max: always translate")
                      .c_str(),
                  parser_num<uint32_t>(config.translate_minimize), false, "<n>");
+        opts.add_flag(group, "translate-opt-log",
+                      format("Use one literal per bit of a variable's domain to translate minimize constraint [",
+                             flag_str(config.translate_minimize_log), "]")
+                          .c_str(),
+                      config.translate_minimize_log);
         opts.add_flag(
             group, "add-order-clauses",
             format("Add binary clauses for order literals after translation [", flag_str(config.add_order_clauses), "]")
                 .c_str(),
             config.add_order_clauses);
+        opts.add_flag(group, "lazy-attach",
+                      format("Attach reified constraints once their literal is true [",
+                             flag_str(config.lazy_attach), "]")
+                          .c_str(),
+                      config.lazy_attach);
+        opts.add(group, "subsum-limit",
+                 format("Introduce at most <n> auxiliary variables for common sub-sums [", config.subsum_limit, "]")
+                     .c_str(),
+                 parser_num<uint32_t>(config.subsum_limit), false, "<n>");
+        opts.add(group, "probe-time",
+                 format("Probe bounds of variables for at most <s> seconds [", config.probe_time,
+                        "]\n"
+                        "      Only propagates linear sum constraints that are facts")
+                     .c_str(),
+                 parser_num(config.probe_time), false, "<s>");
+        opts.add_flag(group, "translate-plan",
+                      format("Select clause translations globally by their cost and benefit [",
+                             flag_str(config.translate_plan), "]")
+                          .c_str(),
+                      config.translate_plan);
+        opts.add(group, "buffer-limit",
+                 format("Commit buffered clauses once they contain <n> literals [", config.buffer_limit, "]\n"
+                        "      <n>: buffer size in literals (0 for unlimited)")
+                     .c_str(),
+                 parser_num<uint64_t>(config.buffer_limit), false, "<n>");
 
         // propagation
         opts.add(group, "order-heuristic",
                  format("Make the decision heuristic aware of order literls [",
                         heuristic_str(config.default_solver_config.heuristic),
                         "]\n"
-                        "      <arg>: {none,max-chain}[,<i>]\n"
+                        "      <arg>: {none,max-chain,hint,objective}[,<i>]\n"
                         "        none     : use clasp's heuristic\n"
                         "        max-chain: assign chains of literals\n"
+                        "        hint     : assign variables towards their hints\n"
+                        "        objective: assign variables towards better objective values\n"
                         "      <i>  : Only enable for thread <i>")
                      .c_str(),
                  parser_heuristic(*theory), true);
+        opts.add_flag(group, "hint-model",
+                      format("Use the values of the last model as hints [", flag_str(config.hint_model), "]").c_str(),
+                      config.hint_model);
         opts.add(group, "sign-value",
                  format("Configure the sign of order literals [", config.default_solver_config.sign_value,
                         "]\n"
@@ -552,6 +632,9 @@ extern "C" auto clingcon_register_options(clingcon_theory_t *theory, clingo_opti
         opts.add_flag(group, "check-state,@2",
                       format("Check state invariants [", flag_str(config.check_state), "]").c_str(),
                       config.check_state);
+        opts.add_flag(group, "log-plan,@2",
+                      format("Log the decisions of the translation planner [", flag_str(config.log_plan), "]").c_str(),
+                      config.log_plan);
     }
     CLINGCON_CATCH;
 }
@@ -585,6 +668,11 @@ extern "C" auto clingcon_on_model(clingcon_theory_t *theory, clingo_model_t *mod
     CLINGCON_CATCH;
 }
 
+extern "C" auto clingcon_set_minimize_bound(clingcon_theory_t *theory, int64_t bound) -> bool {
+    CLINGCON_TRY { theory->propagator.set_minimize_bound(bound); }
+    CLINGCON_CATCH;
+}
+
 extern "C" auto clingcon_lookup_symbol(clingcon_theory_t *theory, clingo_symbol_t symbol, size_t *index) -> bool {
     if (auto var = theory->propagator.get_index(Clingo::Symbol{symbol}); var.has_value()) {
         *index = *var + 1;
@@ -599,6 +687,93 @@ extern "C" auto clingcon_get_symbol(clingcon_theory_t *theory, size_t index) ->
     return sym->to_c();
 }
 
+extern "C" auto clingcon_add_variable(clingcon_theory_t *theory, clingo_symbol_t name, size_t *index) -> bool {
+    CLINGCON_TRY { *index = theory->propagator.add_variable(Clingo::Symbol{name}) + 1; }
+    CLINGCON_CATCH;
+}
+
+extern "C" auto clingcon_add_sum(clingcon_theory_t *theory, clingo_literal_t literal, int const *coefficients,
+                                 size_t const *variables, size_t size, int rhs, bool strict) -> bool {
+    CLINGCON_TRY {
+        auto elems = make_elems(theory->propagator, coefficients, variables, size);
+        rhs = check_valid_value(safe_add<sum_t>(check_valid_value(rhs), simplify(elems, true)));
+        theory->propagator.queue_sum(literal, std::move(elems), rhs, strict);
+    }
+    CLINGCON_CATCH;
+}
+
+extern "C" auto clingcon_add_distinct(clingcon_theory_t *theory, clingo_literal_t literal, int const *coefficients,
+                                      size_t const *variables, int const *constants, size_t size) -> bool {
+    CLINGCON_TRY {
+        auto elems = make_elems(theory->propagator, coefficients, variables, size);
+        std::vector<std::pair<CoVarVec, val_t>> terms;
+        terms.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            auto &term = terms.emplace_back(CoVarVec{}, check_valid_value(constants[i])).first; // NOLINT
+            if (elems[i].first != 0) {
+                term.emplace_back(elems[i]);
+            }
+        }
+        theory->propagator.queue_distinct(literal, std::move(terms));
+    }
+    CLINGCON_CATCH;
+}
+
+extern "C" auto clingcon_get_bound_literal(clingcon_theory_t *theory, clingo_control_t *control, size_t variable,
+                                           int value, clingo_literal_t *literal) -> bool {
+    CLINGCON_TRY {
+        int co = 1;
+        auto elems = make_elems(theory->propagator, &co, &variable, 1);
+        auto key = std::make_pair(elems.front().second, check_valid_value(value));
+        auto it = theory->bound_literals.find(key);
+        if (it == theory->bound_literals.end()) {
+            Clingo::Control ctl{control, false};
+            clingo_atom_t atom{0};
+            {
+                auto backend = ctl.backend();
+                atom = backend.add_atom();
+                backend.rule(true, {atom}, {});
+            }
+            it = theory->bound_literals.emplace(key, static_cast<clingo_literal_t>(atom)).first;
+            theory->propagator.queue_sum(it->second, std::move(elems), value, true);
+        }
+        *literal = it->second;
+    }
+    CLINGCON_CATCH;
+}
+
+extern "C" auto clingcon_on_check(clingcon_theory_t *theory, clingcon_check_callback_t callback, void *data)
+    -> bool {
+    CLINGCON_TRY {
+        if (callback == nullptr) {
+            theory->propagator.on_check(nullptr);
+        } else {
+            theory->propagator.on_check(
+                [theory, callback, data](uint32_t thread_id) { handle_error(callback(theory, thread_id, data)); });
+        }
+    }
+    CLINGCON_CATCH;
+}
+
+extern "C" auto clingcon_add_lazy_sum(clingcon_theory_t *theory, int const *coefficients, size_t const *variables,
+                                      size_t size, int rhs) -> bool {
+    CLINGCON_TRY {
+        auto elems = make_elems(theory->propagator, coefficients, variables, size);
+        rhs = check_valid_value(safe_add<sum_t>(check_valid_value(rhs), simplify(elems, true)));
+        theory->propagator.add_lazy_sum(std::move(elems), rhs);
+    }
+    CLINGCON_CATCH;
+}
+
+extern "C" auto clingcon_set_hint(clingcon_theory_t *theory, size_t variable, int value) -> bool {
+    CLINGCON_TRY {
+        int co = 1;
+        auto elems = make_elems(theory->propagator, &co, &variable, 1);
+        theory->propagator.set_hint(elems.front().second, check_valid_value(value));
+    }
+    CLINGCON_CATCH;
+}
+
 extern "C" void clingcon_assignment_begin(clingcon_theory_t *theory, uint32_t thread_id, size_t *index) {
     static_cast<void>(theory);
     static_cast<void>(thread_id);
@@ -24,6 +24,7 @@
 
 #include "clingcon/constraints.hh"
 
+#include <algorithm>
 #include <set>
 #include <stdexcept>
 
@@ -82,6 +83,8 @@ template <bool tagged, typename T> class SumConstraintStateImpl final : public T
         }
     }
 
+    [[nodiscard]] auto detachable() const -> bool override { return !tagged; }
+
     void undo(val_t i, val_t diff) override {
         sum_t x = static_cast<sum_t>(i) * diff;
         if (x > 0) {
@@ -423,7 +426,11 @@ class SumConstraintState : public AbstractConstraintState {
         auto ass = cc.assignment();
 
         sum_t rhs = this->rhs(solver);
-        if (ass.is_false(constraint_.literal()) || upper_bound_ <= rhs) {
+        if (ass.is_false(constraint_.literal())) {
+            return {true, true};
+        }
+        if (upper_bound_ <= rhs) {
+            ++cc.statistics().translate_redundant;
             return {true, true};
         }
 
@@ -434,12 +441,12 @@ class SumConstraintState : public AbstractConstraintState {
         assert(lower >= 0);
 
         // translation to weight constraints
-        if (literal_variable_ratio_(solver) <= config.weight_constraint_ratio) {
+        if (literal_variable_ratio_(solver, lower) <= config.weight_constraint_ratio) {
             return weight_translate_(solver, cc, lower);
         }
 
         bool translate = cc.statistics().translate_clauses < config.clause_limit_total &&
-                         clause_estimate_(solver, lower, upper, config.clause_limit);
+                         clause_estimate_(solver, lower, upper, config.clause_limit) < config.clause_limit;
         if (translate) {
             auto ret = clause_translate_(solver, cc, lower, upper, config.literals_only);
             return {ret, !config.literals_only};
@@ -448,6 +455,42 @@ class SumConstraintState : public AbstractConstraintState {
         return {true, false};
     }
 
+    [[nodiscard]] auto translation_estimate(Config const &config, Solver &solver, InitClauseCreator &cc)
+        -> std::optional<std::pair<uint64_t, double>> final {
+        // Note: The state is not necessarily attached. Thus, the bounds are
+        // calculated from the variables.
+        sum_t lower_bound = 0;
+        sum_t upper_bound = 0;
+        double domain = 0;
+        for (auto [co, var] : constraint_) {
+            auto &vs = solver.var_state(var);
+            if (co > 0) {
+                lower_bound += static_cast<sum_t>(vs.lower_bound()) * co;
+                upper_bound += static_cast<sum_t>(vs.upper_bound()) * co;
+            } else {
+                lower_bound += static_cast<sum_t>(vs.upper_bound()) * co;
+                upper_bound += static_cast<sum_t>(vs.lower_bound()) * co;
+            }
+            domain += static_cast<double>(vs.upper_bound()) - static_cast<double>(vs.lower_bound()) + 1;
+        }
+
+        sum_t rhs = this->rhs(solver);
+        if (cc.assignment().is_false(constraint_.literal()) || upper_bound <= rhs || lower_bound > rhs ||
+            literal_variable_ratio_(solver, rhs - lower_bound) <= config.weight_constraint_ratio) {
+            return std::nullopt;
+        }
+
+        auto estimate = clause_estimate_(solver, rhs - lower_bound, rhs - upper_bound, config.clause_limit);
+        if (estimate >= config.clause_limit) {
+            return std::nullopt;
+        }
+
+        // each bound change of a variable in the domain triggers propagation
+        // over all watched variables
+        auto cost = static_cast<double>(constraint_.size()) * domain;
+        return std::make_pair(static_cast<uint64_t>(estimate), cost);
+    }
+
   private:
     SumConstraintState(SumConstraint &constraint) : constraint_{constraint} {}
 
@@ -468,11 +511,10 @@ class SumConstraintState : public AbstractConstraintState {
     }
 
     //! Estimate the size of the translation in terms of the number of literals
-    //! necessary for the weight constraint.
-    auto literal_variable_ratio_(Solver &solver) const -> double {
+    //! necessary for the weight constraint given the slack of the constraint.
+    auto literal_variable_ratio_(Solver &solver, sum_t slack) const -> double {
         sum_t n = 0;
         sum_t estimate = 0;
-        sum_t slack = rhs(solver) - lower_bound_;
         for (auto [co, var] : constraint_) {
             auto &vs = solver.var_state(var);
             if (vs.lower_bound() != vs.upper_bound()) {
@@ -532,7 +574,10 @@ class SumConstraintState : public AbstractConstraintState {
         return {true, false};
     }
 
-    auto clause_estimate_(Solver &solver, sum_t lower, sum_t upper, sum_t maximum) -> bool {
+    //! Estimate the number of clauses necessary to translate the constraint.
+    //!
+    //! The estimation stops once the given maximum is reached.
+    auto clause_estimate_(Solver &solver, sum_t lower, sum_t upper, sum_t maximum) -> sum_t {
         std::vector<std::tuple<size_t, sum_t, sum_t, sum_t>> todo{{0, 1, lower, upper}};
         sum_t estimate{0};
 
@@ -559,7 +604,7 @@ class SumConstraintState : public AbstractConstraintState {
             if (lower < 0) {
                 estimate += 1;
                 if (estimate >= maximum) {
-                    return false;
+                    return estimate;
                 }
                 continue;
             }
@@ -590,12 +635,12 @@ class SumConstraintState : public AbstractConstraintState {
             n = value_upper - value_lower + 1;
             estimate += n;
             if (estimate >= maximum) {
-                return false;
+                return estimate;
             }
             todo.emplace_back(i + 1, n, lower, upper);
         }
 
-        return true;
+        return estimate;
     }
 
     auto clause_translate_(Solver &solver, AbstractClauseCreator &cc, sum_t lower, sum_t upper,
@@ -730,23 +775,61 @@ class MinimizeConstraintState : public AbstractConstraintState {
     ~MinimizeConstraintState() override = default;
 
     //! Get the number of literals required to translate the minimize constraint.
-    [[nodiscard]] auto required_literals(Solver &solver) const -> int64_t {
+    //!
+    //! With a logarithmic encoding, only one literal per bit of the domain
+    //! width is required.
+    [[nodiscard]] auto required_literals(Solver &solver, bool log) const -> int64_t {
         int64_t size = 0;
         for (auto [co, var] : constraint_) {
             auto &vs = solver.var_state(var);
-            size += static_cast<int64_t>(vs.max_bound()) - vs.min_bound() - 1;
+            auto width = static_cast<int64_t>(vs.max_bound()) - vs.min_bound();
+            if (log) {
+                for (; width > 0; width /= 2) {
+                    ++size;
+                }
+            } else {
+                size += width - 1;
+            }
         }
         return size;
     }
 
+    //! Check if the weights of the logarithmic encoding fit into a val_t.
+    //!
+    //! The largest bit of each element gets weight co*2^k, which overflows
+    //! for wide domains and large coefficients.
+    [[nodiscard]] auto log_weights_fit(Solver &solver) const -> bool {
+        constexpr auto max = static_cast<sum_t>(std::numeric_limits<val_t>::max());
+        for (auto [co, var] : constraint_) {
+            auto &vs = solver.var_state(var);
+            auto width = static_cast<sum_t>(vs.max_bound()) - vs.min_bound();
+            sum_t weight = 1;
+            while (2 * weight <= width) {
+                weight *= 2;
+            }
+            auto abs_co = std::abs(static_cast<sum_t>(co));
+            if (abs_co * std::abs(static_cast<sum_t>(vs.min_bound())) > max || (width > 0 && abs_co * weight > max)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     //! Translate the minimize constraint into clasp's minimize constraint.
     [[nodiscard]] auto translate(Config const &config, Solver &solver, InitClauseCreator &cc, ConstraintVec &added)
         -> std::pair<bool, bool> final {
-        static_cast<void>(added);
+        bool log = config.translate_minimize_log;
+        if (log && !log_weights_fit(solver)) {
+            // an already translated objective has to be extended
+            if (!solver.translate_minimize()) {
+                return {true, false};
+            }
+            log = false;
+        }
 
         bool translate = solver.translate_minimize();
         translate = translate || config.translate_minimize == std::numeric_limits<uint32_t>::max();
-        translate = translate || required_literals(solver) < config.translate_minimize;
+        translate = translate || required_literals(solver, log) < config.translate_minimize;
 
         if (!translate) {
             return {true, false};
@@ -757,6 +840,10 @@ class MinimizeConstraintState : public AbstractConstraintState {
         for (auto [co, var] : constraint_) {
             auto &vs = solver.var_state(var);
             cc.add_minimize(TRUE_LIT, safe_mul(co, vs.min_bound()), 0);
+            if (log) {
+                log_translate_(config, solver, cc, co, var, added);
+                continue;
+            }
             for (auto value = vs.min_bound(); value < vs.max_bound(); ++value) {
                 cc.add_minimize(-solver.get_literal(cc, vs, value), co, 0);
             }
@@ -768,6 +855,33 @@ class MinimizeConstraintState : public AbstractConstraintState {
   private:
     MinimizeConstraintState(MinimizeConstraint &constraint) : constraint_{constraint} {}
 
+    //! Add the difference between a variable and its smallest value to the
+    //! objective using one 0/1 variable per bit.
+    //!
+    //! The bits are linked to the variable by two sum constraints.
+    static void log_translate_(Config const &config, Solver &solver, InitClauseCreator &cc, val_t co, var_t var,
+                               ConstraintVec &added) {
+        auto min = solver.var_state(var).min_bound();
+        auto width = static_cast<sum_t>(solver.var_state(var).max_bound()) - min;
+        if (width == 0) {
+            return;
+        }
+
+        CoVarVec elems{{1, var}};
+        for (sum_t weight = 1; weight <= width; weight *= 2) {
+            auto bit = solver.add_variable(0, 1);
+            // Note: adding variables invalidates references to var states
+            auto &vs = solver.var_state(bit);
+            cc.add_minimize(-solver.get_literal(cc, vs, 0), safe_mul(co, static_cast<val_t>(weight)), 0);
+            elems.emplace_back(static_cast<val_t>(-weight), bit);
+        }
+        added.emplace_back(SumConstraint::create(TRUE_LIT, min, elems, config.sort_constraints));
+        for (auto &co_var : elems) {
+            co_var.first = -co_var.first;
+        }
+        added.emplace_back(SumConstraint::create(TRUE_LIT, -min, elems, config.sort_constraints));
+    }
+
     MinimizeConstraintState(MinimizeConstraintState const &x)
         : AbstractConstraintState{} // NOLINT
           ,
@@ -791,9 +905,53 @@ class MinimizeConstraintState : public AbstractConstraintState {
     bool todo_{false};
 };
 
+//! Fixed part, coefficient, and variable of a term with at most one variable.
+using DiffElement = std::tuple<val_t, val_t, var_t>;
+
+//! Introduce a variable for the given term with the given bounds and make it
+//! equal to the term.
+//!
+//! No variable is introduced if the term has only one variable.
+[[nodiscard]] auto term_variable(Config const &config, Solver &solver, DistinctElement const &elements, sum_t lower,
+                                 sum_t upper, ConstraintVec &added) -> DiffElement {
+    assert(!elements.empty());
+    if (elements.size() == 1) {
+        return {elements.fixed(), elements.begin()->first, elements.begin()->second};
+    }
+
+    auto var = solver.add_variable(static_cast<val_t>(lower), static_cast<val_t>(upper));
+    CoVarVec sum_elems;
+    sum_elems.emplace_back(-1, var);
+    sum_elems.insert(sum_elems.end(), elements.begin(), elements.end());
+    added.emplace_back(SumConstraint::create(TRUE_LIT, -elements.fixed(), sum_elems, config.sort_constraints));
+    for (auto &co_var : sum_elems) {
+        co_var.first = -co_var.first;
+    }
+    added.emplace_back(SumConstraint::create(TRUE_LIT, elements.fixed(), sum_elems, config.sort_constraints));
+
+    return {0, 1, var};
+}
+
+//! Get a literal that is true iff the given term is equal to the given
+//! value.
+//!
+//! The first element of the returned pair is false if adding clauses failed.
+[[nodiscard]] auto equal_literal(Solver &solver, InitClauseCreator &cc, DiffElement const &elem, sum_t value)
+    -> std::pair<bool, lit_t> {
+    auto [fixed, co, var] = elem;
+    if (var == INVALID_VAR) {
+        return {true, value == fixed ? TRUE_LIT : -TRUE_LIT};
+    }
+    if ((value - fixed) % co != 0) {
+        return {true, -TRUE_LIT};
+    }
+
+    auto adjust = (value - fixed) / co;
+    return solver.get_equal_literal(cc, solver.var_state(var), static_cast<val_t>(adjust));
+}
+
 //! Capture the state of a distinct constraint.
 class DistinctConstraintState final : public AbstractConstraintState {
-    using DiffElement = std::tuple<val_t, val_t, var_t>;
     using DiffVec = std::vector<DiffElement>;
 
   public:
@@ -863,7 +1021,8 @@ class DistinctConstraintState final : public AbstractConstraintState {
             if (!constraint_[idx].empty()) {
                 domains[idx].enumerate([&](sum_t value) {
                     if (counts[value] > 1) {
-                        elem = var_(config, solver, idx, added);
+                        auto [lower, upper] = assigned_[idx];
+                        elem = term_variable(config, solver, constraint_[idx], lower, upper, added);
                         return false;
                     }
                     return true;
@@ -885,33 +1044,9 @@ class DistinctConstraintState final : public AbstractConstraintState {
                 if (!domain.contains(value)) {
                     continue;
                 }
-                auto [fixed, co, var] = diff_elems[idx];
-                auto lit = TRUE_LIT;
-                if (var != INVALID_VAR) {
-                    // lit == var<=value && var>=value
-                    //     == var<=value && not var<=value-1
-                    auto &vs = solver.var_state(var);
-
-                    auto adjust = (value - fixed) / co;
-                    auto a = solver.get_literal(cc, vs, static_cast<val_t>(adjust));
-                    auto b = -solver.get_literal(cc, vs, static_cast<val_t>(adjust - 1));
-
-                    if (a == TRUE_LIT) {
-                        lit = b;
-                    } else if (b == -TRUE_LIT) {
-                        lit = a;
-                    } else {
-                        lit = cc.add_literal();
-                        if (!cc.add_clause({-a, -b, lit})) {
-                            return {false, false};
-                        }
-                        if (!cc.add_clause({a, -lit})) {
-                            return {false, false};
-                        }
-                        if (!cc.add_clause({b, -lit})) {
-                            return {false, false};
-                        }
-                    }
+                auto [ret, lit] = equal_literal(solver, cc, diff_elems[idx], value);
+                if (!ret) {
+                    return {false, false};
                 }
                 wlits.emplace_back(lit, 1);
             }
@@ -1041,29 +1176,6 @@ class DistinctConstraintState final : public AbstractConstraintState {
     void inactive_level(level_t level) override { inactive_level_ = level; }
 
   private:
-    //! Introduce a variable and make it equal to the term.
-    [[nodiscard]] auto var_(Config const &config, Solver &solver, uint32_t idx, ConstraintVec &added) -> DiffElement {
-        auto [lower, upper] = assigned_[idx];
-        auto const &elements = constraint_[idx];
-
-        assert(!elements.empty());
-        if (elements.size() == 1) {
-            return {elements.fixed(), elements.begin()->first, elements.begin()->second};
-        }
-
-        auto var = solver.add_variable(static_cast<val_t>(lower), static_cast<val_t>(upper));
-        CoVarVec sum_elems;
-        sum_elems.emplace_back(-1, var);
-        sum_elems.insert(sum_elems.end(), elements.begin(), elements.end());
-        added.emplace_back(SumConstraint::create(TRUE_LIT, -elements.fixed(), sum_elems, config.sort_constraints));
-        for (auto &co_var : sum_elems) {
-            co_var.first = -co_var.first;
-        }
-        added.emplace_back(SumConstraint::create(TRUE_LIT, elements.fixed(), sum_elems, config.sort_constraints));
-
-        return {0, 1, var};
-    }
-
     //! Estimate the size of the translation in terms of the number of weight
     //! constraints and return whether the constraint should be translated.
     //!
@@ -1314,229 +1426,1110 @@ class DistinctConstraintState final : public AbstractConstraintState {
     bool todo_{false};
 };
 
-//! Capture the state of a nonlinear constraint.
-class NonlinearConstraintState : public AbstractConstraintState {
+//! Capture the state of a count constraint.
+//!
+//! Propagation only considers the bounds of terms. For each bound `(v, l, u)`
+//! of the constraint, terms assigned to `v` and terms whose bounds include `v`
+//! are counted. If `u` terms are assigned to `v`, then `v` is removed from the
+//! bounds of the remaining terms. If only `l` terms can still take value `v`,
+//! then all of them are assigned to `v`.
+//!
+//! The counts are maintained incrementally when the bounds of dirty terms are
+//! recalculated. Terms are only scanned if a bound propagates.
+class CountConstraintState final : public AbstractConstraintState {
   public:
-    NonlinearConstraintState(NonlinearConstraint &constraint) : constraint_{constraint} {}
+    CountConstraintState(CountConstraint &constraint) : constraint_{constraint} {
+        // empty ranges do not contribute to the counts
+        assigned_.resize(constraint_.size(), {1, 0});
+        in_dirty_.resize(constraint_.size(), false);
+        dirty_.reserve(constraint_.size());
+        num_fixed_.resize(constraint_.num_bounds(), 0);
+        num_candidates_.resize(constraint_.num_bounds(), 0);
+        values_.reserve(constraint_.num_bounds());
+        for (uint32_t i = 0, e = constraint_.num_bounds(); i != e; ++i) {
+            values_.emplace_back(std::get<0>(constraint_.bound(i)), i);
+        }
+        std::sort(values_.begin(), values_.end());
+    }
 
-    NonlinearConstraintState() = delete;
-    NonlinearConstraintState(NonlinearConstraintState const &) = delete;
-    NonlinearConstraintState(NonlinearConstraintState &&) = delete;
-    auto operator=(NonlinearConstraintState const &) -> NonlinearConstraintState & = delete;
-    auto operator=(NonlinearConstraintState &&) -> NonlinearConstraintState & = delete;
-    ~NonlinearConstraintState() override = default;
+    CountConstraintState(CountConstraintState &&) = delete;
+    auto operator=(CountConstraintState const &) -> CountConstraintState & = delete;
+    auto operator=(CountConstraintState &&) -> CountConstraintState & = delete;
+    ~CountConstraintState() override = default;
 
-    //! Get the associated nonlinear constraint.
-    auto constraint() -> AbstractConstraint & override { return constraint_; }
+    auto constraint() -> CountConstraint & override { return constraint_; }
 
-    //! Attach the constraint to a solver.
     void attach(Solver &solver) override {
-        solver.add_var_watch(constraint_.var_x(), 0, *this);
-        solver.add_var_watch(constraint_.var_y(), 1, *this);
-        if (constraint_.has_co_c()) {
-            solver.add_var_watch(constraint_.var_z(), 2, *this);
+        val_t idx = 0;
+        for (auto const &element : constraint_) {
+            init_(solver, idx);
+            for (auto [co, var] : element) {
+                static_cast<void>(co);
+                solver.add_var_watch(var, idx, *this);
+            }
+            ++idx;
         }
     }
 
-    //! Detach the constraint from a solver.
     void detach(Solver &solver) override {
-        solver.remove_var_watch(constraint_.var_x(), 0, *this);
-        solver.remove_var_watch(constraint_.var_y(), 1, *this);
-        if (constraint_.has_co_c()) {
-            solver.remove_var_watch(constraint_.var_z(), 2, *this);
+        val_t idx = 0;
+        for (auto const &element : constraint_) {
+            for (auto [co, var] : element) {
+                static_cast<void>(co);
+                solver.remove_var_watch(var, idx, *this);
+            }
+            ++idx;
         }
     }
 
-    //! Translate a constraint to simpler constraints.
+    //! Translate small enough count constraints to weight constraints.
     [[nodiscard]] auto translate(Config const &config, Solver &solver, InitClauseCreator &cc, ConstraintVec &added)
         -> std::pair<bool, bool> override {
-        static_cast<void>(config);
-        static_cast<void>(solver);
-        static_cast<void>(cc);
-        static_cast<void>(added);
-        return {true, false};
+        if (!estimate_(config.distinct_limit)) {
+            return {true, false};
+        }
+
+        std::vector<std::optional<DiffElement>> diff_elems;
+        diff_elems.resize(constraint_.size());
+        std::vector<Clingo::WeightedLiteral> wlits;
+
+        for (size_t i = 0, e = constraint_.num_bounds(); i != e; ++i) {
+            auto [value, lower, upper] = constraint_.bound(i);
+
+            // literals that are true iff a term takes the value
+            wlits.clear();
+            for (uint32_t idx = 0, end = constraint_.size(); idx != end; ++idx) {
+                auto [term_lower, term_upper] = assigned_[idx];
+                if (value < term_lower || term_upper < value) {
+                    continue;
+                }
+                auto &elem = diff_elems[idx];
+                if (!elem.has_value()) {
+                    elem = constraint_[idx].empty() ? DiffElement{constraint_[idx].fixed(), 1, INVALID_VAR}
+                                                    : term_variable(config, solver, constraint_[idx], term_lower,
+                                                                    term_upper, added);
+                }
+                auto [ret, lit] = equal_literal(solver, cc, *elem, value);
+                if (!ret) {
+                    return {false, false};
+                }
+                if (lit != -TRUE_LIT) {
+                    wlits.emplace_back(lit, 1);
+                }
+            }
+            auto size = static_cast<val_t>(wlits.size());
+
+            if (lower > size) {
+                if (!cc.add_clause({-constraint_.literal()})) {
+                    return {false, false};
+                }
+                continue;
+            }
+            // at most upper terms take the value
+            if (upper < size && !cc.add_weight_constraint(constraint_.literal(), wlits, upper,
+                                                          Clingo::WeightConstraintType::RightImplication)) {
+                return {false, false};
+            }
+            // at least lower terms take the value
+            if (lower > 0) {
+                for (auto &wlit : wlits) {
+                    wlit = Clingo::WeightedLiteral{-wlit.literal(), wlit.weight()};
+                }
+                if (!cc.add_weight_constraint(constraint_.literal(), wlits, size - lower,
+                                              Clingo::WeightConstraintType::RightImplication)) {
+                    return {false, false};
+                }
+            }
+        }
+
+        return {true, true};
     }
 
-    //! Copy the constraint state (for another solver)
     [[nodiscard]] auto copy() const -> UniqueConstraintState override {
-        return std::unique_ptr<NonlinearConstraintState>{
-            new NonlinearConstraintState{constraint_, inactive_level_, todo_}};
+        return std::unique_ptr<CountConstraintState>{new CountConstraintState(*this)};
     }
 
-    //! Inform the solver about updated bounds of a variable.
-    //!
-    //! Value i depends on the value passed when registering the watch and diff
-    //! is the change to the bound of the watched variable.
+    //! Mark the element whose bound has changed as dirty.
     [[nodiscard]] auto update(val_t i, val_t diff) -> bool override {
-        // Note: there is no need to calculate intermediate state because the
-        // bound propagation is constant time. The function simply returns true
-        // to enqueue the constraint for propagation.
-        static_cast<void>(i);
         static_cast<void>(diff);
+        mark_dirty_(i);
         return true;
     }
 
-    //! Similar to update but when the bound of a variable is backtracked.
     void undo(val_t i, val_t diff) override {
-        static_cast<void>(i);
         static_cast<void>(diff);
+        mark_dirty_(i);
     }
 
-    static auto get_bound(nsum_t co_a, VarState &vs_x, VarState &vs_y)
-        -> std::tuple<nsum_t, nsum_t, nsum_t, nsum_t, nsum_t, nsum_t> {
-        nsum_t lower_x = vs_x.lower_bound();
-        nsum_t upper_x = vs_x.upper_bound();
-        nsum_t lower_y = vs_y.lower_bound();
-        nsum_t upper_y = vs_y.upper_bound();
+    [[nodiscard]] auto propagate(Solver &solver, AbstractClauseCreator &cc, bool check_state) -> bool override {
+        static_cast<void>(check_state);
+        update_(solver);
 
-        auto lhs_ll = co_a * lower_x * lower_y;
-        auto lhs_lu = co_a * lower_x * upper_y;
-        auto lhs_ul = co_a * upper_x * lower_y;
-        auto lhs_uu = co_a * upper_x * upper_y;
+        auto ass = cc.assignment();
+        auto lit = -constraint_.literal();
+        auto size = constraint_.size();
+
+        for (size_t i = 0, e = constraint_.num_bounds(); i != e; ++i) {
+            auto [value, lower, upper] = constraint_.bound(i);
+            auto num_fixed = static_cast<size_t>(num_fixed_[i]);
+            auto num_candidates = static_cast<size_t>(num_candidates_[i]);
+
+            // nothing can be propagated if the counts are within the bound
+            // and there are unassigned terms that can take the value
+            bool at_upper = num_fixed >= static_cast<size_t>(upper) && num_candidates > num_fixed;
+            bool at_lower = num_candidates <= static_cast<size_t>(lower) && num_candidates > num_fixed;
+            if (!at_upper && !at_lower && num_fixed <= static_cast<size_t>(upper) &&
+                num_candidates >= static_cast<size_t>(lower)) {
+                continue;
+            }
 
-        nsum_t lower = std::min({lhs_ll, lhs_lu, lhs_ul, lhs_uu});
-        nsum_t upper = std::max({lhs_ll, lhs_lu, lhs_ul, lhs_uu});
+            // collect terms assigned to the value and terms excluding it
+            fixed_.clear();
+            excluded_.clear();
+            for (uint32_t idx = 0; idx != size; ++idx) {
+                auto [term_lower, term_upper] = assigned_[idx];
+                if (term_lower == value && term_upper == value) {
+                    fixed_.emplace_back(idx);
+                } else if (term_upper < value || value < term_lower) {
+                    excluded_.emplace_back(idx);
+                }
+            }
 
-        if (lower == lhs_ll) {
-            return {lower_x, upper_x, lower_y, upper_y, lower, upper};
+            // no further term can take the value
+            if (fixed_.size() >= static_cast<size_t>(upper)) {
+                reason_.clear();
+                add_reason_(ass, lit);
+                for (size_t j = 0, n = std::min<size_t>(fixed_.size(), upper + 1); j != n; ++j) {
+                    reason_assigned_(solver, cc, fixed_[j]);
+                }
+                if (fixed_.size() > static_cast<size_t>(upper)) {
+                    return cc.add_clause(reason_);
+                }
+                for (uint32_t idx = 0; idx != size; ++idx) {
+                    auto [term_lower, term_upper] = assigned_[idx];
+                    if (term_lower == value && term_upper != value) {
+                        if (!restrict_(solver, cc, -1, idx, static_cast<sum_t>(value) + 1)) {
+                            return false;
+                        }
+                    } else if (term_upper == value && term_lower != value) {
+                        if (!restrict_(solver, cc, 1, idx, static_cast<sum_t>(value) - 1)) {
+                            return false;
+                        }
+                    }
+                }
+            }
+
+            // all remaining terms have to take the value
+            if (size - excluded_.size() <= static_cast<size_t>(lower)) {
+                reason_.clear();
+                add_reason_(ass, lit);
+                for (size_t j = 0, n = std::min<size_t>(excluded_.size(), size - lower + 1); j != n; ++j) {
+                    reason_excluded_(solver, cc, excluded_[j], value);
+                }
+                if (size - excluded_.size() < static_cast<size_t>(lower)) {
+                    return cc.add_clause(reason_);
+                }
+                for (uint32_t idx = 0; idx != size; ++idx) {
+                    auto [term_lower, term_upper] = assigned_[idx];
+                    if (term_upper < value || value < term_lower) {
+                        continue;
+                    }
+                    if (term_lower < value && !restrict_(solver, cc, -1, idx, value)) {
+                        return false;
+                    }
+                    if (term_upper > value && !restrict_(solver, cc, 1, idx, value)) {
+                        return false;
+                    }
+                }
+            }
         }
-        if (lower == lhs_lu) {
-            return {lower_x, upper_x, upper_y, lower_y, lower, upper};
+
+        return true;
+    }
+
+    void check_full(Solver &solver) override {
+        std::vector<sum_t> values;
+        for (auto const &element : constraint_) {
+            sum_t value = element.fixed();
+            for (auto [co, var] : element) {
+                auto &vs = solver.var_state(var);
+                if (!vs.is_assigned()) {
+                    throw std::logic_error("variable is not fully assigned");
+                }
+                value += static_cast<sum_t>(co) * vs.lower_bound();
+            }
+            values.emplace_back(value);
         }
-        if (lower == lhs_ul) {
-            return {upper_x, lower_x, lower_y, upper_y, lower, upper};
+        for (size_t i = 0, e = constraint_.num_bounds(); i != e; ++i) {
+            auto [value, lower, upper] = constraint_.bound(i);
+            auto count = std::count(values.begin(), values.end(), value);
+            if (count < lower || count > upper) {
+                throw std::logic_error("invalid count constraint");
+            }
         }
-        return {upper_x, lower_x, upper_y, lower_y, lower, upper};
     }
 
-    //! Propagates the constraint.
-    [[nodiscard]] auto propagate(Solver &solver, AbstractClauseCreator &cc, bool check_state) -> bool override {
-        // TODO: This implementation is just a first shot that has to be
-        // refined further.
-        static_cast<void>(cc);
-        static_cast<void>(check_state);
+    [[nodiscard]] auto mark_todo(bool todo) -> bool override {
+        auto ret = todo_;
+        todo_ = todo;
+        return ret;
+    }
 
-        auto &vs_x = solver.var_state(constraint_.var_x());
-        auto &vs_y = solver.var_state(constraint_.var_y());
-        nsum_t co_a = constraint_.co_a();
+    [[nodiscard]] auto marked_todo() const -> bool override { return todo_; }
 
-        auto [lower_x, upper_x, lower_y, upper_y, lower_t, upper_t] = get_bound(co_a, vs_x, vs_y);
+    [[nodiscard]] auto removable() -> bool override { return true; }
 
-        VarState *vs_z{nullptr};
-        nsum_t co_b = constraint_.co_b();
-        nsum_t lower_z{0};
-        nsum_t upper_z{0};
-        nsum_t lower_u{0};
-        nsum_t upper_u{0};
-        if (co_b != 0) {
-            vs_z = &solver.var_state(constraint_.var_z());
-            if (co_b < 0) {
-                lower_z = vs_z->upper_bound();
-                upper_z = vs_z->lower_bound();
-            } else {
-                lower_z = vs_z->lower_bound();
-                upper_z = vs_z->upper_bound();
-            }
-            lower_u += co_b * lower_z;
-            upper_u += co_b * upper_z;
-        }
-        nsum_t rhs = constraint_.rhs();
-        nsum_t lower_lhs = lower_t + lower_u;
-        nsum_t upper_lhs = upper_t + upper_u;
+  protected:
+    [[nodiscard]] auto inactive_level() const -> level_t override { return inactive_level_; }
+
+    void inactive_level(level_t level) override { inactive_level_ = level; }
+
+  private:
+    //! Estimate the size of the translation in terms of the number of
+    //! equality literals and return whether the constraint should be
+    //! translated.
+    auto estimate_(sum_t maximum) -> bool {
+        sum_t cost = 0;
+        for (auto [lower, upper] : assigned_) {
+            if (lower < MIN_VAL || upper > MAX_VAL) {
+                return false;
+            }
+            for (size_t i = 0, e = constraint_.num_bounds(); i != e; ++i) {
+                auto value = std::get<0>(constraint_.bound(i));
+                if (lower <= value && value <= upper) {
+                    ++cost;
+                }
+            }
+        }
+        return cost < maximum;
+    }
+
+    //! Propagate that the term of the given element is less than or equal to
+    //! (s > 0) or greater than or equal to (s < 0) the given value.
+    //!
+    //! For terms with more than one variable, the generated clause only
+    //! excludes the current bound of the term. This suffices because the
+    //! constraint is propagated again once the bound changed.
+    auto restrict_(Solver &solver, AbstractClauseCreator &cc, int s, uint32_t idx, sum_t value) -> bool {
+        auto ass = cc.assignment();
+        auto &reason = solver.temp_reason();
+        reason.assign(reason_.begin(), reason_.end());
+        auto const &elem = constraint_[idx];
+
+        if (elem.size() == 1) {
+            auto [co, var] = *elem.begin();
+            auto &vs = solver.var_state(var);
+            auto rhs = value - elem.fixed();
+            lit_t lit{0};
+            if (s * co > 0) {
+                lit = solver.update_literal(cc, vs, static_cast<val_t>(floordiv<sum_t>(rhs, co)),
+                                            reason.empty() ? Clingo::TruthValue::True : Clingo::TruthValue::Free);
+            } else {
+                lit = -solver.update_literal(cc, vs, static_cast<val_t>(-floordiv<sum_t>(rhs, -co) - 1),
+                                             reason.empty() ? Clingo::TruthValue::False : Clingo::TruthValue::Free);
+            }
+            if (ass.is_true(lit)) {
+                return true;
+            }
+            reason.emplace_back(lit);
+            return cc.add_clause(reason);
+        }
+
+        for (auto [co, var] : elem) {
+            auto &vs = solver.var_state(var);
+            lit_t lit{0};
+            if (s * co > 0) {
+                lit = -solver.get_literal(cc, vs, vs.upper_bound());
+                if (!ass.is_fixed(lit)) {
+                    reason.emplace_back(lit);
+                }
+                lit = solver.get_literal(cc, vs, vs.upper_bound() - 1);
+            } else {
+                lit = solver.get_literal(cc, vs, vs.lower_bound() - 1);
+                if (!ass.is_fixed(lit)) {
+                    reason.emplace_back(lit);
+                }
+                lit = -solver.get_literal(cc, vs, vs.lower_bound());
+            }
+            if (ass.is_true(lit)) {
+                return true;
+            }
+            reason.emplace_back(lit);
+        }
+
+        return cc.add_clause(reason);
+    }
+
+    //! Add the given literal to the reason unless it is fixed.
+    void add_reason_(Clingo::Assignment ass, lit_t lit) {
+        if (!ass.is_fixed(lit)) {
+            reason_.emplace_back(lit);
+        }
+    }
+
+    //! Explain why the term of the given element is assigned.
+    void reason_assigned_(Solver &solver, AbstractClauseCreator &cc, uint32_t idx) {
+        auto ass = cc.assignment();
+        for (auto [co, var] : constraint_[idx]) {
+            static_cast<void>(co);
+            auto &vs = solver.var_state(var);
+            add_reason_(ass, -solver.get_literal(cc, vs, vs.upper_bound()));
+            add_reason_(ass, solver.get_literal(cc, vs, vs.lower_bound() - 1));
+        }
+    }
+
+    //! Explain why the term of the given element cannot take the given value.
+    void reason_excluded_(Solver &solver, AbstractClauseCreator &cc, uint32_t idx, val_t value) {
+        auto ass = cc.assignment();
+        // either the lower bound is too large or the upper bound too small
+        auto s = assigned_[idx].first > value ? 1 : -1;
+        for (auto [co, var] : constraint_[idx]) {
+            auto &vs = solver.var_state(var);
+            if (s * co > 0) {
+                add_reason_(ass, solver.get_literal(cc, vs, vs.lower_bound() - 1));
+            } else {
+                add_reason_(ass, -solver.get_literal(cc, vs, vs.upper_bound()));
+            }
+        }
+    }
+
+    void mark_dirty_(uint32_t idx) {
+        if (!in_dirty_[idx]) {
+            in_dirty_[idx] = true;
+            dirty_.emplace_back(idx);
+        }
+    }
+
+    //! Add (s = 1) or remove (s = -1) the i-th element from the counts of the
+    //! bounds whose values lie within its range.
+    void count_(uint32_t idx, int32_t s) {
+        auto [lower, upper] = assigned_[idx];
+        auto it = std::lower_bound(values_.begin(), values_.end(), lower,
+                                   [](auto const &a, sum_t b) { return a.first < b; });
+        for (auto ie = values_.end(); it != ie && it->first <= upper; ++it) {
+            num_candidates_[it->second] += s;
+            if (lower == upper) {
+                num_fixed_[it->second] += s;
+            }
+        }
+    }
+
+    //! Recalculate the bounds of the i-th element of the constraint.
+    void init_(Solver &solver, uint32_t idx) {
+        count_(idx, -1);
+        auto const &element = constraint_[idx];
+        sum_t upper = element.fixed();
+        sum_t lower = element.fixed();
+        for (auto [co, var] : element) {
+            auto &vs = solver.var_state(var);
+            if (co > 0) {
+                upper += static_cast<sum_t>(co) * vs.upper_bound();
+                lower += static_cast<sum_t>(co) * vs.lower_bound();
+            } else {
+                upper += static_cast<sum_t>(co) * vs.lower_bound();
+                lower += static_cast<sum_t>(co) * vs.upper_bound();
+            }
+        }
+        assigned_[idx] = {lower, upper};
+        count_(idx, 1);
+    }
+
+    //! Recalculate all elements marked dirty.
+    void update_(Solver &solver) {
+        for (auto i : dirty_) {
+            init_(solver, i);
+            in_dirty_[i] = false;
+        }
+        dirty_.clear();
+    }
+
+    CountConstraintState(CountConstraintState const &x)
+        : AbstractConstraintState{} // NOLINT
+          ,
+          constraint_{x.constraint_}, assigned_{x.assigned_}, dirty_{x.dirty_}, in_dirty_{x.in_dirty_},
+          values_{x.values_}, num_fixed_{x.num_fixed_}, num_candidates_{x.num_candidates_},
+          inactive_level_{x.inactive_level_}, todo_{x.todo_} {}
+
+    CountConstraint &constraint_;
+    std::vector<std::pair<sum_t, sum_t>> assigned_;
+    std::vector<uint32_t> dirty_;
+    std::vector<bool> in_dirty_;
+    //! The values of the bounds sorted together with their indices.
+    std::vector<std::pair<val_t, uint32_t>> values_;
+    //! The number of terms assigned to the value of each bound.
+    std::vector<int32_t> num_fixed_;
+    //! The number of terms whose range includes the value of each bound.
+    std::vector<int32_t> num_candidates_;
+    std::vector<uint32_t> fixed_;
+    std::vector<uint32_t> excluded_;
+    std::vector<lit_t> reason_;
+    level_t inactive_level_{0};
+    bool todo_{false};
+};
+
+//! Capture the state of a nonlinear constraint.
+class NonlinearConstraintState : public AbstractConstraintState {
+  public:
+    NonlinearConstraintState(NonlinearConstraint &constraint) : constraint_{constraint} {}
+
+    NonlinearConstraintState() = delete;
+    NonlinearConstraintState(NonlinearConstraintState const &) = delete;
+    NonlinearConstraintState(NonlinearConstraintState &&) = delete;
+    auto operator=(NonlinearConstraintState const &) -> NonlinearConstraintState & = delete;
+    auto operator=(NonlinearConstraintState &&) -> NonlinearConstraintState & = delete;
+    ~NonlinearConstraintState() override = default;
+
+    //! Get the associated nonlinear constraint.
+    auto constraint() -> AbstractConstraint & override { return constraint_; }
+
+    //! Attach the constraint to a solver.
+    void attach(Solver &solver) override {
+        solver.add_var_watch(constraint_.var_x(), 0, *this);
+        solver.add_var_watch(constraint_.var_y(), 1, *this);
+        if (constraint_.has_co_c()) {
+            solver.add_var_watch(constraint_.var_z(), 2, *this);
+        }
+    }
+
+    //! Detach the constraint from a solver.
+    void detach(Solver &solver) override {
+        solver.remove_var_watch(constraint_.var_x(), 0, *this);
+        solver.remove_var_watch(constraint_.var_y(), 1, *this);
+        if (constraint_.has_co_c()) {
+            solver.remove_var_watch(constraint_.var_z(), 2, *this);
+        }
+    }
+
+    //! Translate a constraint to simpler constraints.
+    [[nodiscard]] auto translate(Config const &config, Solver &solver, InitClauseCreator &cc, ConstraintVec &added)
+        -> std::pair<bool, bool> override {
+        static_cast<void>(config);
+        static_cast<void>(solver);
+        static_cast<void>(cc);
+        static_cast<void>(added);
+        return {true, false};
+    }
+
+    //! Copy the constraint state (for another solver)
+    [[nodiscard]] auto copy() const -> UniqueConstraintState override {
+        return std::unique_ptr<NonlinearConstraintState>{
+            new NonlinearConstraintState{constraint_, inactive_level_, todo_}};
+    }
+
+    //! Inform the solver about updated bounds of a variable.
+    //!
+    //! Value i depends on the value passed when registering the watch and diff
+    //! is the change to the bound of the watched variable.
+    [[nodiscard]] auto update(val_t i, val_t diff) -> bool override {
+        // Note: there is no need to calculate intermediate state because the
+        // bound propagation is constant time. The function simply returns true
+        // to enqueue the constraint for propagation.
+        static_cast<void>(i);
+        static_cast<void>(diff);
+        return true;
+    }
+
+    //! Similar to update but when the bound of a variable is backtracked.
+    void undo(val_t i, val_t diff) override {
+        static_cast<void>(i);
+        static_cast<void>(diff);
+    }
+
+    static auto get_bound(nsum_t co_a, VarState &vs_x, VarState &vs_y)
+        -> std::tuple<nsum_t, nsum_t, nsum_t, nsum_t, nsum_t, nsum_t> {
+        nsum_t lower_x = vs_x.lower_bound();
+        nsum_t upper_x = vs_x.upper_bound();
+        nsum_t lower_y = vs_y.lower_bound();
+        nsum_t upper_y = vs_y.upper_bound();
+
+        auto lhs_ll = co_a * lower_x * lower_y;
+        auto lhs_lu = co_a * lower_x * upper_y;
+        auto lhs_ul = co_a * upper_x * lower_y;
+        auto lhs_uu = co_a * upper_x * upper_y;
+
+        nsum_t lower = std::min({lhs_ll, lhs_lu, lhs_ul, lhs_uu});
+        nsum_t upper = std::max({lhs_ll, lhs_lu, lhs_ul, lhs_uu});
+
+        if (lower == lhs_ll) {
+            return {lower_x, upper_x, lower_y, upper_y, lower, upper};
+        }
+        if (lower == lhs_lu) {
+            return {lower_x, upper_x, upper_y, lower_y, lower, upper};
+        }
+        if (lower == lhs_ul) {
+            return {upper_x, lower_x, lower_y, upper_y, lower, upper};
+        }
+        return {upper_x, lower_x, upper_y, lower_y, lower, upper};
+    }
+
+    //! Propagates the constraint.
+    [[nodiscard]] auto propagate(Solver &solver, AbstractClauseCreator &cc, bool check_state) -> bool override {
+        // TODO: This implementation is just a first shot that has to be
+        // refined further.
+        static_cast<void>(cc);
+        static_cast<void>(check_state);
+
+        auto &vs_x = solver.var_state(constraint_.var_x());
+        auto &vs_y = solver.var_state(constraint_.var_y());
+        nsum_t co_a = constraint_.co_a();
+
+        auto [lower_x, upper_x, lower_y, upper_y, lower_t, upper_t] = get_bound(co_a, vs_x, vs_y);
+
+        VarState *vs_z{nullptr};
+        nsum_t co_b = constraint_.co_b();
+        nsum_t lower_z{0};
+        nsum_t upper_z{0};
+        nsum_t lower_u{0};
+        nsum_t upper_u{0};
+        if (co_b != 0) {
+            vs_z = &solver.var_state(constraint_.var_z());
+            if (co_b < 0) {
+                lower_z = vs_z->upper_bound();
+                upper_z = vs_z->lower_bound();
+            } else {
+                lower_z = vs_z->lower_bound();
+                upper_z = vs_z->upper_bound();
+            }
+            lower_u += co_b * lower_z;
+            upper_u += co_b * upper_z;
+        }
+        nsum_t rhs = constraint_.rhs();
+        nsum_t lower_lhs = lower_t + lower_u;
+        nsum_t upper_lhs = upper_t + upper_u;
+
+        if (upper_lhs <= rhs) {
+            solver.mark_inactive(*this);
+            return true;
+        }
+
+        // std::cerr << "check lower: " << co_a << "*" << lower_x << "*" << lower_y << " + " << co_b << "*" << lower_z
+        // << " <= " << constraint_.rhs() << "    (" << (co_a * lower_x * lower_y + co_b * lower_z) << " <= " <<
+        // constraint_.rhs() << ")" << std::endl;
+        if (lower_lhs > rhs) {
+            // TODO: For nonlinear constraints it is probably necessary to add
+            // the range, in general. But there should also be some cases where
+            // this is not required. For example, if all bounds are positive
+            // (or negative) the term a*b should behave monotonely.
+            // std::cerr << "  the constraint is conflicting" << std::endl;
+            auto &reason = solver.temp_reason();
+            reason.emplace_back(-solver.get_literal(cc, vs_x, vs_x.upper_bound()));
+            reason.emplace_back(solver.get_literal(cc, vs_x, vs_x.lower_bound() - 1));
+            reason.emplace_back(-solver.get_literal(cc, vs_y, vs_y.upper_bound()));
+            reason.emplace_back(solver.get_literal(cc, vs_y, vs_y.lower_bound() - 1));
+            if (vs_z != nullptr) {
+                if (co_b < 0) {
+                    reason.emplace_back(-solver.get_literal(cc, *vs_z, vs_z->upper_bound()));
+                } else {
+                    reason.emplace_back(solver.get_literal(cc, *vs_z, vs_z->lower_bound() - 1));
+                }
+            }
+            return cc.add_clause(reason);
+        }
+
+        // TODO: the code has to be refined.
+        // Some first throw to propagate the linear term. This should be quite
+        // similar to the propagation of linear constraints.
+        // - we want: lower_t + co_b * bound_z <= rhs;
+        // - co_b * bound_z <= rhs - lower_t;
+        //   - case co_b > 0:
+        //     - bound_z <= floor((rhs - lower_t) / co_b)
+        //     - we get a new upper bound for term u
+        //   - case co_b < 0:
+        //     - bound_z >= ceil((rhs - lower_t) / co_b)
+        //     - we get a new lower bound for term u
+        if (vs_z != nullptr) {
+            if (co_b > 0) {
+                nsum_t bound_z = floordiv(rhs - lower_t, co_b);
+                if (bound_z < upper_z) {
+                    // std::cerr << "we got a new lower bound for y: " << bound_y << " < " << upper_y << std::endl;
+                    auto &reason = solver.temp_reason();
+                    reason.emplace_back(-solver.get_literal(cc, vs_x, vs_x.upper_bound()));
+                    reason.emplace_back(solver.get_literal(cc, vs_x, vs_x.lower_bound() - 1));
+                    reason.emplace_back(-solver.get_literal(cc, vs_y, vs_y.upper_bound()));
+                    reason.emplace_back(solver.get_literal(cc, vs_y, vs_y.lower_bound() - 1));
+
+                    reason.emplace_back(solver.get_literal(cc, *vs_z, static_cast<val_t>(bound_z)));
+                    if (!cc.add_clause(reason)) {
+                        return false;
+                    }
+                }
+            }
+            if (co_b < 0) {
+                nsum_t bound_z = ceildiv(rhs - lower_t, co_b);
+                if (bound_z > upper_z) {
+                    // std::cerr << "we got a new lower bound for y: " << bound_z << " > " << upper_z << std::endl;
+                    auto &reason = solver.temp_reason();
+                    reason.emplace_back(-solver.get_literal(cc, vs_x, vs_x.upper_bound()));
+                    reason.emplace_back(solver.get_literal(cc, vs_x, vs_x.lower_bound() - 1));
+                    reason.emplace_back(-solver.get_literal(cc, vs_y, vs_y.upper_bound()));
+                    reason.emplace_back(solver.get_literal(cc, vs_y, vs_y.lower_bound() - 1));
+
+                    reason.emplace_back(-solver.get_literal(cc, *vs_z, static_cast<val_t>(bound_z) - 1));
+                    if (!cc.add_clause(reason)) {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        // TODO: the nonlinear terms should be propagated too
+        if (co_a > 0) {
+            nsum_t bound_xy = floordiv(rhs - lower_u, co_a);
+            if (bound_xy < upper_x * upper_y) {
+                // std::cerr << "better upper bound for x*y: " << bound_xy << " < " << upper_x << "*" << upper_y << " =
+                // " << (upper_x * upper_y) << std::endl;
+                //  ub(x*y) = xy
+                //  case lb(y) > 0
+                //    (the sign of xy determines the maximum)
+                //    x <= ceil(max(xy / l(y), xy / u(y)))
+                //  case ub(y) < 0:
+                //    should be similar to the previous case
+                //  the other cases are more complicated
+                //    we can get different bound combinations for reasons for ub(x*y)
+                //    we can get a conjunction of x => l | x <= u as reason
+                //    if one of the terms is false, we can stil propgate
+                //    or by relaxing the bounds until one of the becomes false and the other can be propgate
+                //    this looks tedious and is probably best developed on paper
+            }
+        }
+
+        return true;
+    }
+
+    //! Check if the solver meets the state invariants.
+    void check_full(Solver &solver) override {
+        // This function asserts that co_a*a*b + co_b*c <= rhs
+        auto &vs_x = solver.var_state(constraint_.var_x());
+        auto &vs_y = solver.var_state(constraint_.var_y());
+        nsum_t co_a = constraint_.co_a();
+        nsum_t lhs = co_a * vs_x.lower_bound() * vs_y.lower_bound();
+        if (constraint_.has_co_c()) {
+            auto vs_z = solver.var_state(constraint_.var_z());
+            nsum_t co_b = constraint_.co_b();
+            lhs += co_b * vs_z.lower_bound();
+        }
+        nsum_t rhs = constraint_.rhs();
+        if (lhs > rhs) {
+            throw std::logic_error("invalid solution");
+        }
+    }
+
+    //! Mark the constraint state as todo item.
+    auto mark_todo(bool todo) -> bool override {
+        auto ret = todo_;
+        todo_ = todo;
+        return ret;
+    }
+    //! Returns true if the constraint is marked as todo item.
+    [[nodiscard]] auto marked_todo() const -> bool override { return todo_; }
+
+    //! Returns true if the constraint is removable.
+    [[nodiscard]] auto removable() -> bool override { return true; }
+
+  protected:
+    //! Get the level on which the constraint became inactive.
+    [[nodiscard]] auto inactive_level() const -> level_t override { return inactive_level_; }
+
+    //! Set the level on which the constraint became inactive.
+    void inactive_level(level_t level) override { inactive_level_ = level; }
+
+  private:
+    explicit NonlinearConstraintState(NonlinearConstraint &constraint, level_t inactive_level, bool todo)
+        : constraint_{constraint}, inactive_level_{inactive_level}, todo_{todo} {}
+
+    NonlinearConstraint &constraint_;
+    level_t inactive_level_{0};
+    bool todo_{false};
+};
+
+//! Get the lower and upper bound of term `co*var`.
+auto term_bounds(Solver &solver, val_t co, var_t var) -> std::pair<sum_t, sum_t> {
+    auto &vs = solver.var_state(var);
+    sum_t lower = static_cast<sum_t>(co) * vs.lower_bound();
+    sum_t upper = static_cast<sum_t>(co) * vs.upper_bound();
+    if (co < 0) {
+        std::swap(lower, upper);
+    }
+    return {lower, upper};
+}
+
+//! Get the order literal representing `co*var <= value`.
+//!
+//! Values outside of the range of the variable are mapped to the true and
+//! false literals.
+auto term_literal(Solver &solver, AbstractClauseCreator &cc, val_t co, var_t var, sum_t value) -> lit_t {
+    assert(co != 0);
+    auto bound = co > 0 ? floordiv<sum_t>(value, co) : -floordiv<sum_t>(value, -co) - 1;
+    bound = std::clamp<sum_t>(bound, sum_t{MIN_VAL} - 1, MAX_VAL);
+    auto lit = solver.get_literal(cc, solver.var_state(var), static_cast<val_t>(bound));
+    return co > 0 ? lit : -lit;
+}
+
+//! Capture the state of a max constraint.
+//!
+//! The constraint is propagated bounds consistently and all reasons consist
+//! of order literals.
+class MaxConstraintState final : public AbstractConstraintState {
+  public:
+    MaxConstraintState(MaxConstraint &constraint) : constraint_{constraint} {}
+
+    MaxConstraintState() = delete;
+    MaxConstraintState(MaxConstraintState const &) = delete;
+    MaxConstraintState(MaxConstraintState &&) = delete;
+    auto operator=(MaxConstraintState const &) -> MaxConstraintState & = delete;
+    auto operator=(MaxConstraintState &&) -> MaxConstraintState & = delete;
+    ~MaxConstraintState() override = default;
+
+    //! Get the associated max constraint.
+    auto constraint() -> AbstractConstraint & override { return constraint_; }
+
+    //! Attach the constraint to a solver.
+    void attach(Solver &solver) override {
+        solver.add_var_watch(constraint_.var(), 0, *this);
+        for (size_t i = 0, e = constraint_.size(); i != e; ++i) {
+            solver.add_var_watch(constraint_[i].second, static_cast<val_t>(i + 1), *this);
+        }
+    }
+
+    //! Detach the constraint from a solver.
+    void detach(Solver &solver) override {
+        solver.remove_var_watch(constraint_.var(), 0, *this);
+        for (size_t i = 0, e = constraint_.size(); i != e; ++i) {
+            solver.remove_var_watch(constraint_[i].second, static_cast<val_t>(i + 1), *this);
+        }
+    }
+
+    //! Max constraints are not translated.
+    [[nodiscard]] auto translate(Config const &config, Solver &solver, InitClauseCreator &cc, ConstraintVec &added)
+        -> std::pair<bool, bool> override {
+        static_cast<void>(config);
+        static_cast<void>(solver);
+        static_cast<void>(cc);
+        static_cast<void>(added);
+        return {true, false};
+    }
+
+    //! Copy the constraint state (for another solver)
+    [[nodiscard]] auto copy() const -> UniqueConstraintState override {
+        return std::unique_ptr<MaxConstraintState>{new MaxConstraintState{constraint_, inactive_level_, todo_}};
+    }
+
+    //! Enqueue the constraint for propagation.
+    //!
+    //! The bounds are recomputed during propagation, which is linear in the
+    //! number of terms.
+    [[nodiscard]] auto update(val_t i, val_t diff) -> bool override {
+        static_cast<void>(i);
+        static_cast<void>(diff);
+        return true;
+    }
+
+    //! There is no intermediate state to undo.
+    void undo(val_t i, val_t diff) override {
+        static_cast<void>(i);
+        static_cast<void>(diff);
+    }
 
-        if (upper_lhs <= rhs) {
-            solver.mark_inactive(*this);
-            return true;
-        }
+    //! Propagates the constraint.
+    //!
+    //! For `x = max(t_0, ..., t_n)`, the function enforces
+    //! - `max(lower(t_i)) <= x <= max(upper(t_i))`,
+    //! - `t_i <= upper(x)`, and
+    //! - `t_i >= lower(x)` if t_i is the only term that can reach lower(x).
+    [[nodiscard]] auto propagate(Solver &solver, AbstractClauseCreator &cc, bool check_state) -> bool override {
+        static_cast<void>(check_state);
 
-        // std::cerr << "check lower: " << co_a << "*" << lower_x << "*" << lower_y << " + " << co_b << "*" << lower_z
-        // << " <= " << constraint_.rhs() << "    (" << (co_a * lower_x * lower_y + co_b * lower_z) << " <= " <<
-        // constraint_.rhs() << ")" << std::endl;
-        if (lower_lhs > rhs) {
-            // TODO: For nonlinear constraints it is probably necessary to add
-            // the range, in general. But there should also be some cases where
-            // this is not required. For example, if all bounds are positive
-            // (or negative) the term a*b should behave monotonely.
-            // std::cerr << "  the constraint is conflicting" << std::endl;
+        auto lit = -constraint_.literal();
+        auto var = constraint_.var();
+        auto &vs = solver.var_state(var);
+        sum_t lower_x = vs.lower_bound();
+        sum_t upper_x = vs.upper_bound();
+
+        sum_t lower = std::numeric_limits<sum_t>::min();
+        sum_t upper = std::numeric_limits<sum_t>::min();
+        size_t idx_lower = 0;
+        size_t idx_support = 0;
+        size_t num_support = 0;
+        for (size_t i = 0, e = constraint_.size(); i != e; ++i) {
+            auto [co, var_i] = constraint_[i];
+            auto [lower_i, upper_i] = term_bounds(solver, co, var_i);
+            if (lower_i > lower) {
+                lower = lower_i;
+                idx_lower = i;
+            }
+            upper = std::max(upper, upper_i);
+            if (upper_i >= lower_x) {
+                idx_support = i;
+                ++num_support;
+            }
+        }
+
+        // the maximum is greater or equal to the largest lower bound
+        if (lower_x < lower) {
+            auto [co, var_i] = constraint_[idx_lower];
             auto &reason = solver.temp_reason();
-            reason.emplace_back(-solver.get_literal(cc, vs_x, vs_x.upper_bound()));
-            reason.emplace_back(solver.get_literal(cc, vs_x, vs_x.lower_bound() - 1));
-            reason.emplace_back(-solver.get_literal(cc, vs_y, vs_y.upper_bound()));
-            reason.emplace_back(solver.get_literal(cc, vs_y, vs_y.lower_bound() - 1));
-            if (vs_z != nullptr) {
-                if (co_b < 0) {
-                    reason.emplace_back(-solver.get_literal(cc, *vs_z, vs_z->upper_bound()));
-                } else {
-                    reason.emplace_back(solver.get_literal(cc, *vs_z, vs_z->lower_bound() - 1));
-                }
+            reason.emplace_back(lit);
+            reason.emplace_back(term_literal(solver, cc, co, var_i, lower - 1));
+            reason.emplace_back(-term_literal(solver, cc, 1, var, lower - 1));
+            if (!cc.add_clause(reason)) {
+                return false;
             }
-            return cc.add_clause(reason);
         }
 
-        // TODO: the code has to be refined.
-        // Some first throw to propagate the linear term. This should be quite
-        // similar to the propagation of linear constraints.
-        // - we want: lower_t + co_b * bound_z <= rhs;
-        // - co_b * bound_z <= rhs - lower_t;
-        //   - case co_b > 0:
-        //     - bound_z <= floor((rhs - lower_t) / co_b)
-        //     - we get a new upper bound for term u
-        //   - case co_b < 0:
-        //     - bound_z >= ceil((rhs - lower_t) / co_b)
-        //     - we get a new lower bound for term u
-        if (vs_z != nullptr) {
-            if (co_b > 0) {
-                nsum_t bound_z = floordiv(rhs - lower_t, co_b);
-                if (bound_z < upper_z) {
-                    // std::cerr << "we got a new lower bound for y: " << bound_y << " < " << upper_y << std::endl;
-                    auto &reason = solver.temp_reason();
-                    reason.emplace_back(-solver.get_literal(cc, vs_x, vs_x.upper_bound()));
-                    reason.emplace_back(solver.get_literal(cc, vs_x, vs_x.lower_bound() - 1));
-                    reason.emplace_back(-solver.get_literal(cc, vs_y, vs_y.upper_bound()));
-                    reason.emplace_back(solver.get_literal(cc, vs_y, vs_y.lower_bound() - 1));
+        // the maximum is less than or equal to the largest upper bound
+        if (upper_x > upper) {
+            auto &reason = solver.temp_reason();
+            reason.emplace_back(lit);
+            for (auto [co, var_i] : constraint_) {
+                reason.emplace_back(-term_literal(solver, cc, co, var_i, term_bounds(solver, co, var_i).second));
+            }
+            reason.emplace_back(term_literal(solver, cc, 1, var, upper));
+            if (!cc.add_clause(reason)) {
+                return false;
+            }
+        }
 
-                    reason.emplace_back(solver.get_literal(cc, *vs_z, static_cast<val_t>(bound_z)));
-                    if (!cc.add_clause(reason)) {
-                        return false;
-                    }
+        // all terms are less than or equal to the maximum
+        for (auto [co, var_i] : constraint_) {
+            if (term_bounds(solver, co, var_i).second > upper_x) {
+                auto &reason = solver.temp_reason();
+                reason.emplace_back(lit);
+                reason.emplace_back(-term_literal(solver, cc, 1, var, upper_x));
+                reason.emplace_back(term_literal(solver, cc, co, var_i, upper_x));
+                if (!cc.add_clause(reason)) {
+                    return false;
                 }
             }
-            if (co_b < 0) {
-                nsum_t bound_z = ceildiv(rhs - lower_t, co_b);
-                if (bound_z > upper_z) {
-                    // std::cerr << "we got a new lower bound for y: " << bound_z << " > " << upper_z << std::endl;
-                    auto &reason = solver.temp_reason();
-                    reason.emplace_back(-solver.get_literal(cc, vs_x, vs_x.upper_bound()));
-                    reason.emplace_back(solver.get_literal(cc, vs_x, vs_x.lower_bound() - 1));
-                    reason.emplace_back(-solver.get_literal(cc, vs_y, vs_y.upper_bound()));
-                    reason.emplace_back(solver.get_literal(cc, vs_y, vs_y.lower_bound() - 1));
+        }
 
-                    reason.emplace_back(-solver.get_literal(cc, *vs_z, static_cast<val_t>(bound_z) - 1));
-                    if (!cc.add_clause(reason)) {
-                        return false;
+        // the only term that can reach the lower bound of the maximum has to
+        if (num_support == 1) {
+            auto [co, var_s] = constraint_[idx_support];
+            if (term_bounds(solver, co, var_s).first < lower_x) {
+                auto &reason = solver.temp_reason();
+                reason.emplace_back(lit);
+                reason.emplace_back(term_literal(solver, cc, 1, var, lower_x - 1));
+                for (size_t i = 0, e = constraint_.size(); i != e; ++i) {
+                    if (i != idx_support) {
+                        auto [co_i, var_i] = constraint_[i];
+                        reason.emplace_back(
+                            -term_literal(solver, cc, co_i, var_i, term_bounds(solver, co_i, var_i).second));
                     }
                 }
+                reason.emplace_back(-term_literal(solver, cc, co, var_s, lower_x - 1));
+                if (!cc.add_clause(reason)) {
+                    return false;
+                }
             }
         }
 
-        // TODO: the nonlinear terms should be propagated too
-        if (co_a > 0) {
-            nsum_t bound_xy = floordiv(rhs - lower_u, co_a);
-            if (bound_xy < upper_x * upper_y) {
-                // std::cerr << "better upper bound for x*y: " << bound_xy << " < " << upper_x << "*" << upper_y << " =
-                // " << (upper_x * upper_y) << std::endl;
-                //  ub(x*y) = xy
-                //  case lb(y) > 0
-                //    (the sign of xy determines the maximum)
-                //    x <= ceil(max(xy / l(y), xy / u(y)))
-                //  case ub(y) < 0:
-                //    should be similar to the previous case
-                //  the other cases are more complicated
-                //    we can get different bound combinations for reasons for ub(x*y)
-                //    we can get a conjunction of x => l | x <= u as reason
-                //    if one of the terms is false, we can stil propgate
-                //    or by relaxing the bounds until one of the becomes false and the other can be propgate
-                //    this looks tedious and is probably best developed on paper
+        return true;
+    }
+
+    //! Check if the solver meets the state invariants.
+    void check_full(Solver &solver) override {
+        sum_t value = std::numeric_limits<sum_t>::min();
+        for (auto [co, var] : constraint_) {
+            auto &vs = solver.var_state(var);
+            if (!vs.is_assigned()) {
+                throw std::logic_error("variable is not fully assigned");
+            }
+            value = std::max(value, static_cast<sum_t>(co) * vs.lower_bound());
+        }
+        auto &vs = solver.var_state(constraint_.var());
+        if (!vs.is_assigned()) {
+            throw std::logic_error("variable is not fully assigned");
+        }
+        if (value != vs.lower_bound()) {
+            throw std::logic_error("invalid solution");
+        }
+    }
+
+    //! Mark the constraint state as todo item.
+    auto mark_todo(bool todo) -> bool override {
+        auto ret = todo_;
+        todo_ = todo;
+        return ret;
+    }
+    //! Returns true if the constraint is marked as todo item.
+    [[nodiscard]] auto marked_todo() const -> bool override { return todo_; }
+
+    //! Returns true if the constraint is removable.
+    [[nodiscard]] auto removable() -> bool override { return true; }
+
+  protected:
+    //! Get the level on which the constraint became inactive.
+    [[nodiscard]] auto inactive_level() const -> level_t override { return inactive_level_; }
+
+    //! Set the level on which the constraint became inactive.
+    void inactive_level(level_t level) override { inactive_level_ = level; }
+
+  private:
+    explicit MaxConstraintState(MaxConstraint &constraint, level_t inactive_level, bool todo)
+        : constraint_{constraint}, inactive_level_{inactive_level}, todo_{todo} {}
+
+    MaxConstraint &constraint_;
+    level_t inactive_level_{0};
+    bool todo_{false};
+};
+
+//! Capture the state of a division constraint.
+//!
+//! The quotient and dividend are propagated bounds consistently. For the
+//! divisor, only zero is excluded.
+class DivConstraintState final : public AbstractConstraintState {
+  public:
+    DivConstraintState(DivConstraint &constraint) : constraint_{constraint} {}
+
+    DivConstraintState() = delete;
+    DivConstraintState(DivConstraintState const &) = delete;
+    DivConstraintState(DivConstraintState &&) = delete;
+    auto operator=(DivConstraintState const &) -> DivConstraintState & = delete;
+    auto operator=(DivConstraintState &&) -> DivConstraintState & = delete;
+    ~DivConstraintState() override = default;
+
+    //! Get the associated division constraint.
+    auto constraint() -> AbstractConstraint & override { return constraint_; }
+
+    //! Attach the constraint to a solver.
+    void attach(Solver &solver) override {
+        solver.add_var_watch(constraint_.var_x(), 0, *this);
+        solver.add_var_watch(constraint_.var_y(), 1, *this);
+        solver.add_var_watch(constraint_.var_z(), 2, *this);
+    }
+
+    //! Detach the constraint from a solver.
+    void detach(Solver &solver) override {
+        solver.remove_var_watch(constraint_.var_x(), 0, *this);
+        solver.remove_var_watch(constraint_.var_y(), 1, *this);
+        solver.remove_var_watch(constraint_.var_z(), 2, *this);
+    }
+
+    //! Division constraints are not translated.
+    [[nodiscard]] auto translate(Config const &config, Solver &solver, InitClauseCreator &cc, ConstraintVec &added)
+        -> std::pair<bool, bool> override {
+        static_cast<void>(config);
+        static_cast<void>(solver);
+        static_cast<void>(cc);
+        static_cast<void>(added);
+        return {true, false};
+    }
+
+    //! Copy the constraint state (for another solver)
+    [[nodiscard]] auto copy() const -> UniqueConstraintState override {
+        return std::unique_ptr<DivConstraintState>{new DivConstraintState{constraint_, inactive_level_, todo_}};
+    }
+
+    //! Enqueue the constraint for propagation.
+    [[nodiscard]] auto update(val_t i, val_t diff) -> bool override {
+        static_cast<void>(i);
+        static_cast<void>(diff);
+        return true;
+    }
+
+    //! There is no intermediate state to undo.
+    void undo(val_t i, val_t diff) override {
+        static_cast<void>(i);
+        static_cast<void>(diff);
+    }
+
+    //! Propagates the constraint.
+    //!
+    //! Since the quotient is monotone in the dividend and, for divisors of
+    //! the same sign, in the divisor, it suffices to consider the bounds of
+    //! the negative and positive part of the domain of the divisor.
+    [[nodiscard]] auto propagate(Solver &solver, AbstractClauseCreator &cc, bool check_state) -> bool override {
+        static_cast<void>(check_state);
+
+        auto lit = -constraint_.literal();
+        auto &vs_x = solver.var_state(constraint_.var_x());
+        auto &vs_y = solver.var_state(constraint_.var_y());
+        auto &vs_z = solver.var_state(constraint_.var_z());
+        sum_t lower_x = vs_x.lower_bound();
+        sum_t upper_x = vs_x.upper_bound();
+        sum_t lower_y = vs_y.lower_bound();
+        sum_t upper_y = vs_y.upper_bound();
+        sum_t lower_z = vs_z.lower_bound();
+        sum_t upper_z = vs_z.upper_bound();
+
+        // the divisor must not be zero
+        if (lower_y == 0 || upper_y == 0) {
+            return cc.add_clause({lit, solver.get_literal(cc, vs_y, -1), -solver.get_literal(cc, vs_y, 0)});
+        }
+
+        std::array<sum_t, 4> divisors{};
+        size_t n = 0;
+        if (lower_y < 0) {
+            divisors[n++] = lower_y;
+            divisors[n++] = std::min<sum_t>(upper_y, -1);
+        }
+        if (upper_y > 0) {
+            divisors[n++] = std::max<sum_t>(lower_y, 1);
+            divisors[n++] = upper_y;
+        }
+
+        // propagate the quotient
+        sum_t min_z = std::numeric_limits<sum_t>::max();
+        sum_t max_z = std::numeric_limits<sum_t>::min();
+        for (size_t i = 0; i != n; ++i) {
+            for (auto x : {lower_x, upper_x}) {
+                auto z = x / divisors[i]; // NOLINT
+                min_z = std::min(min_z, z);
+                max_z = std::max(max_z, z);
+            }
+        }
+        if (lower_z < min_z) {
+            auto &reason = solver.temp_reason();
+            reason.emplace_back(lit);
+            bounds_reason_(solver, cc, vs_x, reason);
+            bounds_reason_(solver, cc, vs_y, reason);
+            reason.emplace_back(-term_literal(solver, cc, 1, constraint_.var_z(), min_z - 1));
+            if (!cc.add_clause(reason)) {
+                return false;
+            }
+        }
+        if (upper_z > max_z) {
+            auto &reason = solver.temp_reason();
+            reason.emplace_back(lit);
+            bounds_reason_(solver, cc, vs_x, reason);
+            bounds_reason_(solver, cc, vs_y, reason);
+            reason.emplace_back(term_literal(solver, cc, 1, constraint_.var_z(), max_z));
+            if (!cc.add_clause(reason)) {
+                return false;
+            }
+        }
+
+        // propagate the dividend
+        sum_t min_x = std::numeric_limits<sum_t>::max();
+        sum_t max_x = std::numeric_limits<sum_t>::min();
+        for (size_t i = 0; i != n; ++i) {
+            auto y = divisors[i]; // NOLINT
+            if (y > 0) {
+                min_x = std::min(min_x, min_dividend_(lower_z, y));
+                max_x = std::max(max_x, max_dividend_(upper_z, y));
+            } else {
+                min_x = std::min(min_x, -max_dividend_(upper_z, -y));
+                max_x = std::max(max_x, -min_dividend_(lower_z, -y));
+            }
+        }
+        if (lower_x < min_x) {
+            auto &reason = solver.temp_reason();
+            reason.emplace_back(lit);
+            bounds_reason_(solver, cc, vs_y, reason);
+            bounds_reason_(solver, cc, vs_z, reason);
+            reason.emplace_back(-term_literal(solver, cc, 1, constraint_.var_x(), min_x - 1));
+            if (!cc.add_clause(reason)) {
+                return false;
+            }
+        }
+        if (upper_x > max_x) {
+            auto &reason = solver.temp_reason();
+            reason.emplace_back(lit);
+            bounds_reason_(solver, cc, vs_y, reason);
+            bounds_reason_(solver, cc, vs_z, reason);
+            reason.emplace_back(term_literal(solver, cc, 1, constraint_.var_x(), max_x));
+            if (!cc.add_clause(reason)) {
+                return false;
             }
         }
 
@@ -1545,18 +2538,13 @@ class NonlinearConstraintState : public AbstractConstraintState {
 
     //! Check if the solver meets the state invariants.
     void check_full(Solver &solver) override {
-        // This function asserts that co_a*a*b + co_b*c <= rhs
         auto &vs_x = solver.var_state(constraint_.var_x());
         auto &vs_y = solver.var_state(constraint_.var_y());
-        nsum_t co_a = constraint_.co_a();
-        nsum_t lhs = co_a * vs_x.lower_bound() * vs_y.lower_bound();
-        if (constraint_.has_co_c()) {
-            auto vs_z = solver.var_state(constraint_.var_z());
-            nsum_t co_b = constraint_.co_b();
-            lhs += co_b * vs_z.lower_bound();
+        auto &vs_z = solver.var_state(constraint_.var_z());
+        if (!vs_x.is_assigned() || !vs_y.is_assigned() || !vs_z.is_assigned()) {
+            throw std::logic_error("variable is not fully assigned");
         }
-        nsum_t rhs = constraint_.rhs();
-        if (lhs > rhs) {
+        if (vs_y.lower_bound() == 0 || vs_z.lower_bound() != vs_x.lower_bound() / vs_y.lower_bound()) {
             throw std::logic_error("invalid solution");
         }
     }
@@ -1581,10 +2569,23 @@ class NonlinearConstraintState : public AbstractConstraintState {
     void inactive_level(level_t level) override { inactive_level_ = level; }
 
   private:
-    explicit NonlinearConstraintState(NonlinearConstraint &constraint, level_t inactive_level, bool todo)
+    explicit DivConstraintState(DivConstraint &constraint, level_t inactive_level, bool todo)
         : constraint_{constraint}, inactive_level_{inactive_level}, todo_{todo} {}
 
-    NonlinearConstraint &constraint_;
+    //! The smallest dividend x such that `x / y >= k` for positive y.
+    static auto min_dividend_(sum_t k, sum_t y) -> sum_t { return k > 0 ? k * y : (k - 1) * y + 1; }
+
+    //! The largest dividend x such that `x / y <= k` for positive y.
+    static auto max_dividend_(sum_t k, sum_t y) -> sum_t { return k >= 0 ? k * y + y - 1 : k * y; }
+
+    //! Add the (false) literals stating that the variable is outside of its
+    //! bounds to the given reason.
+    static void bounds_reason_(Solver &solver, AbstractClauseCreator &cc, VarState &vs, std::vector<lit_t> &reason) {
+        reason.emplace_back(solver.get_literal(cc, vs, vs.lower_bound() - 1));
+        reason.emplace_back(-solver.get_literal(cc, vs, vs.upper_bound()));
+    }
+
+    DivConstraint &constraint_;
     level_t inactive_level_{0};
     bool todo_{false};
 };
@@ -1906,6 +2907,10 @@ auto NonlinearConstraint::create_state() -> UniqueConstraintState {
     return std::make_unique<NonlinearConstraintState>(*this);
 }
 
+auto MaxConstraint::create_state() -> UniqueConstraintState { return std::make_unique<MaxConstraintState>(*this); }
+
+auto DivConstraint::create_state() -> UniqueConstraintState { return std::make_unique<DivConstraintState>(*this); }
+
 DistinctElement::DistinctElement(val_t fixed, size_t size, co_var_t *elements, bool sort)
     : fixed_{fixed}, size_{static_cast<uint32_t>(size)}, elements_{elements} {
     if (sort) {
@@ -1942,6 +2947,37 @@ auto DistinctConstraint::create_state() -> UniqueConstraintState {
     return std::make_unique<DistinctConstraintState>(*this);
 }
 
+// class CountConstraint
+
+CountConstraint::CountConstraint(lit_t lit, Elements const &elements, CountBoundVec const &bounds, bool sort)
+    : lit_{lit}, size_{static_cast<uint32_t>(elements.size())}, num_bounds_{static_cast<uint32_t>(bounds.size())} {
+    auto *bound_it = reinterpret_cast<count_bound_t *>(elements_ + elements.size()); // NOLINT
+    for (auto const &bound : bounds) {
+        new (bound_it++) count_bound_t{bound}; // NOLINT
+    }
+    auto *co_var_it = reinterpret_cast<co_var_t *>(bound_it); // NOLINT
+    auto *element_it = elements_;
+    for (auto const &element : elements) {
+        auto *co_var_ib = co_var_it;
+        for (auto const &co_var : element.first) {
+            new (co_var_it++) co_var_t{co_var}; // NOLINT
+        }
+        new (element_it++) DistinctElement{element.second, element.first.size(), co_var_ib, sort}; // NOLINT
+    }
+}
+
+auto CountConstraint::create(lit_t lit, Elements const &elements, CountBoundVec const &bounds, bool sort)
+    -> std::unique_ptr<CountConstraint> {
+    size_t size = sizeof(CountConstraint) + elements.size() * sizeof(DistinctElement) +
+                  bounds.size() * sizeof(count_bound_t);
+    for (auto const &element : elements) {
+        size += element.first.size() * sizeof(co_var_t);
+    }
+    return std::unique_ptr<CountConstraint>{new (operator new(size)) CountConstraint(lit, elements, bounds, sort)};
+}
+
+auto CountConstraint::create_state() -> UniqueConstraintState { return std::make_unique<CountConstraintState>(*this); }
+
 // class DisjointConstraint
 
 DisjointConstraint::DisjointConstraint(lit_t lit, CoVarVec const &elements)
@@ -89,6 +89,14 @@ template <typename... CStrs> auto match(Clingo::AST::Node const &ast, CStrs... s
     return false;
 }
 
+// Check if the given ast is a function with the given name and arity.
+auto match_function(Clingo::AST::Node const &ast, char const *name, size_t arity) -> bool {
+    using namespace Clingo::AST;
+    return ast.type() == Type::Function && ast.get<int>(Attribute::External) == 0 &&
+           ast.get<NodeVector>(Attribute::Arguments).size() == arity &&
+           std::strcmp(ast.get<char const *>(Attribute::Name), name) == 0;
+}
+
 auto shift_rule(Clingo::AST::Node ast) -> Clingo::AST::Node {
     using namespace Clingo::AST;
     if (ast.type() != Type::Rule) {
@@ -220,7 +228,8 @@ struct TheoryRewriter {
         }
         if (ast.type() == Type::TheoryAtom) {
             auto term = ast.get<Node>(Attribute::Term);
-            if (match(term, "sum", "nsum", "diff", "distinct", "disjoint", "minimize", "maximize")) {
+            if (match(term, "sum", "nsum", "diff", "distinct", "disjoint", "gcc", "minimize", "maximize") ||
+                match_function(term, "count", 1)) {
                 auto atom = ast.copy();
 
                 auto elements = atom.get<NodeVector>(Attribute::Elements);
@@ -344,6 +353,7 @@ auto evaluate(Clingo::TheoryTerm const &term) -> Clingo::Symbol {
     }
 
     check_syntax(!match(term, "..", 2));
+    check_syntax(!match(term, "@", 1));
 
     if (term.type() == Clingo::TheoryTermType::Tuple || term.type() == Clingo::TheoryTermType::Function) {
         std::vector<Clingo::Symbol> args;
@@ -463,22 +473,53 @@ auto simplify(NonlinearTermVec &vec, bool drop_zero) -> val_t {
     return builder.add_constraint(literal, elements, rhs, strict);
 }
 
+// Adds a nonlinear constraint.
+//
+// Products of more than two variables are reduced to products of two
+// variables by introducing variables for their (sorted) prefixes. If the
+// resulting constraint does not have the form `a*x*y + b*z <= rhs`, all
+// products are replaced by variables and a linear constraint is added.
 [[nodiscard]] auto add_constraint(AbstractConstraintBuilder &builder, lit_t literal, NonlinearTermVec const &elements,
                                   val_t rhs, bool strict) -> bool {
+    NonlinearTermVec reduced;
+    reduced.reserve(elements.size());
+    size_t num_linear{0};
+    size_t num_nonlinear{0};
+    for (auto const &[co, vars] : elements) {
+        auto &rvars = reduced.emplace_back(co, VarVec{}).second;
+        for (auto var : vars) {
+            if (rvars.size() == 2) {
+                rvars = {builder.add_mul(rvars.front(), rvars.back())};
+            }
+            rvars.emplace_back(var);
+        }
+        if (rvars.size() == 1) {
+            ++num_linear;
+        } else if (rvars.size() == 2) {
+            ++num_nonlinear;
+        }
+    }
+
+    if (num_linear > 1 || num_nonlinear > 1) {
+        CoVarVec celems;
+        celems.reserve(reduced.size());
+        for (auto const &[co, vars] : reduced) {
+            celems.emplace_back(co, vars.size() == 1 ? vars.front() : builder.add_mul(vars.front(), vars.back()));
+        }
+        return builder.add_constraint(literal, celems, rhs, strict);
+    }
+
     var_t var_a{INVALID_VAR};
     var_t var_b{INVALID_VAR};
     val_t co_ab{0};
     var_t var_c{INVALID_VAR};
     val_t co_c{0};
-    for (auto const &[co, vars] : elements) {
-        check_syntax(vars.size() <= 2, "nonlinear terms with more than 2 variables are not supported");
+    for (auto const &[co, vars] : reduced) {
         if (vars.size() == 1) {
-            check_syntax(co_c == 0, "nonlinear sums can have at most one linear term");
             co_c = co;
             var_c = vars.front();
         }
         if (vars.size() == 2) {
-            check_syntax(co_c == 0, "nonlinear sums can have at most one nonlinear term");
             co_ab = co;
             var_a = vars.front();
             var_b = vars.back();
@@ -487,6 +528,9 @@ auto simplify(NonlinearTermVec &vec, bool drop_zero) -> val_t {
     return builder.add_nonlinear(literal, co_ab, var_a, var_b, co_c, var_c, rhs, strict);
 }
 
+auto parse_max(AbstractConstraintBuilder &builder, Clingo::TheoryTerm const &term) -> std::optional<co_var_t>;
+auto parse_div(AbstractConstraintBuilder &builder, Clingo::TheoryTerm const &term) -> co_var_t;
+
 template <class TermVec, bool is_sum = true>
 void parse_constraint_elem(AbstractConstraintBuilder &builder, Clingo::TheoryTerm const &term, TermVec &res) {
     if constexpr (!is_sum) {
@@ -541,8 +585,17 @@ void parse_constraint_elem(AbstractConstraintBuilder &builder, Clingo::TheoryTer
                 push_co_vars(safe_mul(l_co, r_co), l_vars, r_vars, res);
             }
         }
-    } else if (match(term, "**", 2) || match(term, "/", 2) || match(term, "\\", 2)) {
+    } else if (match(term, "**", 2)) {
         push_value(evaluate(term), res);
+    } else if (match(term, "/", 2) || match(term, "\\", 2)) {
+        auto [co, var] = parse_div(builder, term);
+        if (is_valid_var(var)) {
+            push_co_var(co, var, res);
+        } else {
+            push_co(co, res);
+        }
+    } else if (auto co_var = parse_max(builder, term); co_var.has_value()) {
+        push_co_var(co_var->first, co_var->second, res);
     } else if (term.type() == Clingo::TheoryTermType::Symbol || term.type() == Clingo::TheoryTermType::Function ||
                term.type() == Clingo::TheoryTermType::Tuple) {
         push_co_var(1, builder.add_variable(evaluate(term)), res);
@@ -801,6 +854,78 @@ void parse_show(AbstractConstraintBuilder &builder, Clingo::TheoryAtom const &at
     return builder.add_dom(builder.solver_literal(atom.literal()), builder.add_variable(var), elements);
 }
 
+// Parses a term of a distinct or count constraint.
+void parse_term_elem(AbstractConstraintBuilder &builder, Clingo::TheoryTerm const &term,
+                     std::vector<std::pair<CoVarVec, val_t>> &elements) {
+    elements.emplace_back();
+    auto &elem = elements.back();
+    parse_constraint_elem<CoVarVec>(builder, term, elem.first);
+    elem.second = safe_inv(simplify(elem.first));
+}
+
+// Parses terms of form `@max(t_1, ..., t_n)`, `@min(t_1, ..., t_n)`, and
+// `@abs(t)`.
+//
+// The terms are expressed using a variable holding a maximum because
+// `min(t_1, ..., t_n) = -max(-t_1, ..., -t_n)` and `abs(t) = max(t, -t)`.
+// Function terms without the `@` prefix remain variable names. For other
+// terms, the function returns std::nullopt.
+auto parse_max(AbstractConstraintBuilder &builder, Clingo::TheoryTerm const &term) -> std::optional<co_var_t> {
+    if (!match(term, "@", 1)) {
+        return std::nullopt;
+    }
+    auto fun = term.arguments().front();
+    check_syntax(fun.type() == Clingo::TheoryTermType::Function, "Invalid Syntax: invalid @ term");
+    auto args = fun.arguments();
+    bool is_max = std::strcmp(fun.name(), "max") == 0;
+    bool is_min = std::strcmp(fun.name(), "min") == 0;
+    bool is_abs = std::strcmp(fun.name(), "abs") == 0 && args.size() == 1;
+    check_syntax(is_max || is_min || is_abs, "Invalid Syntax: invalid @ term");
+
+    std::vector<std::pair<CoVarVec, val_t>> elements;
+    for (auto const &arg : args) {
+        parse_term_elem(builder, arg, elements);
+    }
+
+    auto negate = [](std::pair<CoVarVec, val_t> &elem) {
+        for (auto &co_var : elem.first) {
+            co_var.first = safe_inv(co_var.first);
+        }
+        elem.second = safe_inv(elem.second);
+    };
+    if (is_abs) {
+        elements.emplace_back(elements.front());
+        negate(elements.back());
+    } else if (is_min) {
+        std::for_each(elements.begin(), elements.end(), negate);
+    }
+
+    return co_var_t{is_min ? -1 : 1, builder.add_max(elements)};
+}
+
+// Parses terms of form `x / y` and `x \ y`.
+//
+// Like for ground terms, division truncates toward zero. If both terms are
+// numbers, the function returns the resulting number together with an
+// invalid variable.
+auto parse_div(AbstractConstraintBuilder &builder, Clingo::TheoryTerm const &term) -> co_var_t {
+    bool is_div = match(term, "/", 2);
+
+    std::vector<std::pair<CoVarVec, val_t>> elements;
+    for (auto const &arg : term.arguments()) {
+        parse_term_elem(builder, arg, elements);
+    }
+    auto const &x = elements.front();
+    auto const &y = elements.back();
+
+    if (x.first.empty() && y.first.empty()) {
+        return {is_div ? safe_div(x.second, y.second) : safe_mod(x.second, y.second), INVALID_VAR};
+    }
+    check_syntax(!y.first.empty() || y.second != 0, "Invalid Syntax: division by zero");
+
+    return {1, is_div ? builder.add_div(x, y) : builder.add_mod(x, y)};
+}
+
 // Currently only distinct constraints in the head are supported. Supporting
 // them in the body would also be possible where they should be strict.
 [[nodiscard]] auto parse_distinct(AbstractConstraintBuilder &builder, Clingo::TheoryAtom const &atom) -> bool {
@@ -809,15 +934,81 @@ void parse_show(AbstractConstraintBuilder &builder, Clingo::TheoryAtom const &at
     for (auto elem : atom.elements()) {
         auto tuple = elem.tuple();
         check_syntax(!tuple.empty() && elem.condition().empty(), "Invalid Syntax: invalid distinct statement");
-        elements.emplace_back();
-        auto &term = elements.back();
-        parse_constraint_elem<CoVarVec>(builder, tuple.front(), term.first);
-        term.second = safe_inv(simplify(term.first));
+        parse_term_elem(builder, tuple.front(), elements);
     }
 
     return builder.add_distinct(builder.solver_literal(atom.literal()), elements);
 }
 
+// Parses count constraints of form `&count(v) { t_1; ...; t_n } <op> k`.
+//
+// Like distinct constraints, count constraints are only supported in the head.
+[[nodiscard]] auto parse_count(AbstractConstraintBuilder &builder, Clingo::TheoryAtom const &atom) -> bool {
+    std::vector<std::pair<CoVarVec, val_t>> elements;
+
+    for (auto elem : atom.elements()) {
+        auto tuple = elem.tuple();
+        check_syntax(!tuple.empty() && elem.condition().empty(), "Invalid Syntax: invalid count statement");
+        parse_term_elem(builder, tuple.front(), elements);
+    }
+
+    auto value = evaluate(atom.term().arguments().front());
+    check_syntax(value.type() == Clingo::SymbolType::Number, "Invalid Syntax: invalid count statement");
+    check_syntax(atom.has_guard(), "Invalid Syntax: invalid count statement");
+    auto guard = atom.guard();
+    auto rhs = evaluate(guard.second);
+    check_syntax(rhs.type() == Clingo::SymbolType::Number, "Invalid Syntax: invalid count statement");
+
+    val_t lower = 0;
+    auto upper = static_cast<val_t>(elements.size());
+    if (std::strcmp(guard.first, "<=") == 0) {
+        upper = rhs.number();
+    } else if (std::strcmp(guard.first, "<") == 0) {
+        upper = safe_sub(rhs.number(), 1);
+    } else if (std::strcmp(guard.first, ">=") == 0) {
+        lower = rhs.number();
+    } else if (std::strcmp(guard.first, ">") == 0) {
+        lower = safe_add(rhs.number(), 1);
+    } else if (std::strcmp(guard.first, "!=") == 0) {
+        // the number of terms is either smaller or larger than the given one
+        auto lit = builder.solver_literal(atom.literal());
+        auto a = builder.add_literal();
+        auto b = builder.add_literal();
+        return builder.add_clause({-lit, a, b}) &&
+               builder.add_count(a, elements, {{check_valid_value(value.number()), 0, safe_sub(rhs.number(), 1)}}) &&
+               builder.add_count(b, elements, {{check_valid_value(value.number()), safe_add(rhs.number(), 1), upper}});
+    } else {
+        lower = upper = rhs.number();
+    }
+
+    return builder.add_count(builder.solver_literal(atom.literal()), elements,
+                             {{check_valid_value(value.number()), lower, upper}});
+}
+
+// Parses global cardinality constraints of form `&gcc { t_1; ...; t_n; v_1 @
+// l_1..u_1; ...; v_m @ l_m..u_m }`.
+[[nodiscard]] auto parse_gcc(AbstractConstraintBuilder &builder, Clingo::TheoryAtom const &atom) -> bool {
+    std::vector<std::pair<CoVarVec, val_t>> elements;
+    CountBoundVec bounds;
+
+    for (auto elem : atom.elements()) {
+        auto tuple = elem.tuple();
+        check_syntax(!tuple.empty() && elem.condition().empty(), "Invalid Syntax: invalid gcc statement");
+        auto const &term = tuple.front();
+        if (match(term, "@", 2)) {
+            auto args = term.arguments();
+            auto value = evaluate(args.front());
+            check_syntax(value.type() == Clingo::SymbolType::Number, "Invalid Syntax: invalid gcc statement");
+            auto [l, r] = parse_dom_elem(args.back());
+            bounds.emplace_back(check_valid_value(value.number()), l, safe_sub(r, 1));
+        } else {
+            parse_term_elem(builder, term, elements);
+        }
+    }
+
+    return builder.add_count(builder.solver_literal(atom.literal()), elements, bounds);
+}
+
 [[nodiscard]] auto parse_disjoint(AbstractConstraintBuilder &builder, Clingo::TheoryAtom const &atom) -> bool {
     CoVarVec elements;
 
@@ -918,6 +1109,14 @@ auto parse(AbstractConstraintBuilder &builder, Clingo::TheoryAtoms theory_atoms)
             if (!parse_distinct(builder, atom)) {
                 return false;
             }
+        } else if (match(atom.term(), "count", 1)) {
+            if (!parse_count(builder, atom)) {
+                return false;
+            }
+        } else if (match(atom.term(), "gcc", 0)) {
+            if (!parse_gcc(builder, atom)) {
+                return false;
+            }
         } else if (match(atom.term(), "disjoint", 0)) {
             if (!parse_disjoint(builder, atom)) {
                 return false;
@@ -25,15 +25,242 @@
 #include "clingcon/propagator.hh"
 #include "clingcon/parsing.hh"
 
+#include <chrono>
+#include <map>
+#include <numeric>
+#include <unordered_set>
+
 namespace Clingcon {
 
 namespace {
 
+//! Hash for sum constraints given by their elements and rhs.
+struct SumHash {
+    auto operator()(std::pair<CoVarVec, sum_t> const &sum) const -> size_t {
+        auto ret = std::hash<sum_t>()(sum.second);
+        for (auto [co, var] : sum.first) {
+            ret = ret * 31 + std::hash<val_t>()(co);
+            ret = ret * 31 + std::hash<var_t>()(var);
+        }
+        return ret;
+    }
+};
+
+//! Propagate bounds of variables over sum constraints holding at the root
+//! level to detect failed probes.
+//!
+//! This is a lightweight bounds propagator independent of the Solver. It
+//! only considers linear sum constraints that are facts and ignores all
+//! other constraints, e.g., distinct, nonlinear, or conditional sum
+//! constraints, as well as the clauses of the program.
+class Prober {
+  public:
+    //! Add a variable with the given bounds.
+    void add_variable(var_t var, val_t lower, val_t upper) { vars_.try_emplace(var, lower, upper); }
+
+    //! Add constraint `elems <= rhs` over previously added variables.
+    //!
+    //! Constraints whose activity might overflow are ignored.
+    void add_constraint(CoVarVec const &elems, val_t rhs) {
+        constexpr sum_t max_activity = std::numeric_limits<sum_t>::max() / 4;
+        sum_t activity = 0;
+        for (auto [co, var] : elems) {
+            auto const &info = vars_.at(var);
+            activity += std::abs(static_cast<sum_t>(co)) * std::max(std::abs(info.lower), std::abs(info.upper));
+            if (activity > max_activity) {
+                return;
+            }
+        }
+        for (auto [co, var] : elems) {
+            vars_.at(var).rows.emplace_back(rows_.size());
+        }
+        rows_.emplace_back(elems, rhs);
+        queued_.emplace_back(false);
+    }
+
+    //! Get the variables with their current bounds.
+    [[nodiscard]] auto variables() const -> std::vector<std::tuple<var_t, sum_t, sum_t>> {
+        std::vector<std::tuple<var_t, sum_t, sum_t>> ret;
+        for (auto const &[var, info] : vars_) {
+            ret.emplace_back(var, info.lower, info.upper);
+        }
+        return ret;
+    }
+
+    //! Get the bounds of a variable.
+    [[nodiscard]] auto bounds(var_t var) const -> std::pair<sum_t, sum_t> {
+        auto const &info = vars_.at(var);
+        return {info.lower, info.upper};
+    }
+
+    //! Permanently restrict the bounds of a variable and propagate.
+    //!
+    //! Returns false if this leads to a conflict.
+    [[nodiscard]] auto tighten(var_t var, sum_t lower, sum_t upper) -> bool {
+        auto ret = update_(var, lower, upper) && propagate_();
+        trail_.clear();
+        return ret;
+    }
+
+    //! Propagate all constraints.
+    //!
+    //! Returns false if this leads to a conflict.
+    [[nodiscard]] auto propagate() -> bool {
+        for (size_t i = 0, e = rows_.size(); i != e; ++i) {
+            enqueue_(i);
+        }
+        auto ret = propagate_();
+        trail_.clear();
+        return ret;
+    }
+
+    //! Tighten the bounds of a variable by bisection.
+    //!
+    //! If probe `x <= mid` fails, then `x > mid` holds and vice versa for the
+    //! upper bound. Bisection stops at the given deadline keeping the bounds
+    //! found so far. Returns false if tightening leads to a conflict.
+    template <class TimePoint> [[nodiscard]] auto bisect(var_t var, TimePoint deadline) -> bool {
+        using Clock = typename TimePoint::clock;
+        auto [lower, upper] = bounds(var);
+        auto lo = lower;
+        auto hi = upper;
+        while (lo < hi && Clock::now() < deadline) {
+            auto mid = lo + (hi - lo) / 2;
+            if (fails(var, lower, mid)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo > lower && !tighten(var, lo, upper)) {
+            return false;
+        }
+
+        std::tie(lower, upper) = bounds(var);
+        lo = lower;
+        hi = upper;
+        while (lo < hi && Clock::now() < deadline) {
+            auto mid = hi - (hi - lo) / 2;
+            if (fails(var, mid, upper)) {
+                hi = mid - 1;
+            } else {
+                lo = mid;
+            }
+        }
+        return hi == upper || tighten(var, lower, hi);
+    }
+
+    //! Check if restricting the bounds of the variable leads to a conflict.
+    //!
+    //! The bounds of all variables are restored afterward.
+    [[nodiscard]] auto fails(var_t var, sum_t lower, sum_t upper) -> bool {
+        auto ret = !update_(var, lower, upper) || !propagate_();
+        for (auto it = trail_.rbegin(), ie = trail_.rend(); it != ie; ++it) {
+            auto &info = vars_.at(std::get<0>(*it));
+            info.lower = std::get<1>(*it);
+            info.upper = std::get<2>(*it);
+        }
+        trail_.clear();
+        return ret;
+    }
+
+  private:
+    struct VarInfo {
+        VarInfo(sum_t lower, sum_t upper) : lower{lower}, upper{upper} {}
+        sum_t lower;
+        sum_t upper;
+        std::vector<size_t> rows;
+    };
+
+    void enqueue_(size_t row) {
+        if (!queued_[row]) {
+            queued_[row] = true;
+            queue_.emplace_back(row);
+        }
+    }
+
+    void clear_queue_() {
+        for (auto row : queue_) {
+            queued_[row] = false;
+        }
+        queue_.clear();
+    }
+
+    //! Restrict the bounds of a variable and enqueue its constraints.
+    auto update_(var_t var, sum_t lower, sum_t upper) -> bool {
+        auto &info = vars_.at(var);
+        lower = std::max(lower, info.lower);
+        upper = std::min(upper, info.upper);
+        if (lower == info.lower && upper == info.upper) {
+            return true;
+        }
+        trail_.emplace_back(var, info.lower, info.upper);
+        info.lower = lower;
+        info.upper = upper;
+        if (lower > upper) {
+            return false;
+        }
+        for (auto row : info.rows) {
+            enqueue_(row);
+        }
+        return true;
+    }
+
+    //! Propagate the queued constraints.
+    //!
+    //! The number of propagation steps is bounded to avoid slow convergence
+    //! on large domains, in which case no conflict is reported.
+    auto propagate_() -> bool {
+        size_t steps = 0;
+        size_t limit = 16 * rows_.size() + 1024;
+        while (!queue_.empty()) {
+            if (++steps > limit) {
+                clear_queue_();
+                return true;
+            }
+            auto row = queue_.back();
+            queue_.pop_back();
+            queued_[row] = false;
+
+            auto const &[elems, rhs] = rows_[row];
+            sum_t min = 0;
+            for (auto [co, var] : elems) {
+                auto const &info = vars_.at(var);
+                min += co > 0 ? co * info.lower : co * info.upper;
+            }
+            if (min > rhs) {
+                clear_queue_();
+                return false;
+            }
+            for (auto [co, var] : elems) {
+                auto const &info = vars_.at(var);
+                auto slack = rhs - min + (co > 0 ? co * info.lower : co * info.upper);
+                auto ret = co > 0 ? update_(var, info.lower, floordiv<sum_t>(slack, co))
+                                  : update_(var, ceildiv<sum_t>(slack, co), info.upper);
+                if (!ret) {
+                    clear_queue_();
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    std::map<var_t, VarInfo> vars_;
+    std::vector<std::pair<CoVarVec, sum_t>> rows_;
+    std::vector<size_t> queue_;
+    std::vector<bool> queued_;
+    std::vector<std::tuple<var_t, sum_t, sum_t>> trail_;
+};
+
 //! CSP builder to use with the parse_theory function.
 class ConstraintBuilder final : public AbstractConstraintBuilder {
+    //! Function computing the bounds of an auxiliary variable.
+    using AuxRange = std::function<std::pair<nsum_t, nsum_t>()>;
+
   public:
     ConstraintBuilder(Propagator &propgator, InitClauseCreator &cc, UniqueMinimizeConstraint minimize)
-        : propagator_{propgator}, cc_{cc}, minimize_{std::move(minimize)} {}
+        : propagator_{propgator}, cc_{cc}, minimize_{std::move(minimize)}, first_var_{propgator.num_variables()} {}
 
     ConstraintBuilder(ConstraintBuilder const &) = delete;
     ConstraintBuilder(ConstraintBuilder &&) noexcept = delete;
@@ -56,18 +283,18 @@ class ConstraintBuilder final : public AbstractConstraintBuilder {
 
         if (elems.size() == 1) {
             auto [co, var] = elems.front();
+            pinned_.emplace(var);
             return propagator_.add_simple(cc_, lit, co, var, rhs, strict);
         }
 
-        propagator_.add_constraint(SumConstraint::create(lit, rhs, elems, propagator_.config().sort_constraints));
+        add_sum_(lit, elems, rhs);
         if (strict) {
             CoVarVec ielems;
             ielems.reserve(elems.size());
             for (auto const &elem : elems) {
                 ielems.emplace_back(safe_inv(elem.first), elem.second);
             }
-            propagator_.add_constraint(
-                SumConstraint::create(-lit, safe_inv(safe_add(rhs, 1)), ielems, propagator_.config().sort_constraints));
+            add_sum_(-lit, std::move(ielems), safe_inv(safe_add(rhs, 1)));
         }
         return true;
     }
@@ -81,6 +308,7 @@ class ConstraintBuilder final : public AbstractConstraintBuilder {
             }
             return add_constraint(lit, vars, rhs, strict);
         }
+        pinned_.insert({var_a, var_b, var_c});
         propagator_.add_constraint(std::make_unique<NonlinearConstraint>(lit, co_ab, var_a, var_b, co_c, var_c, rhs));
         if (strict) {
             propagator_.add_constraint(std::make_unique<NonlinearConstraint>(
@@ -101,6 +329,9 @@ class ConstraintBuilder final : public AbstractConstraintBuilder {
         }
 
         if (elems.size() > 2) {
+            for (auto const &elem : elems) {
+                pin_(elem.first);
+            }
             propagator_.add_constraint(DistinctConstraint::create(lit, elems, propagator_.config().sort_constraints));
             return true;
         }
@@ -160,6 +391,161 @@ class ConstraintBuilder final : public AbstractConstraintBuilder {
         return true;
     }
 
+    //! Add a count constraint.
+    //!
+    //! Bounds are restricted to the number of terms and bounds for the same
+    //! value are intersected. Trivial bounds are dropped.
+    [[nodiscard]] auto add_count(lit_t lit, std::vector<std::pair<CoVarVec, val_t>> const &elems,
+                                 CountBoundVec const &bounds) -> bool override {
+        if (cc_.assignment().is_false(lit)) {
+            return true;
+        }
+
+        auto size = static_cast<val_t>(elems.size());
+        CountBoundVec sorted{bounds};
+        std::sort(sorted.begin(), sorted.end());
+        CountBoundVec cbounds;
+        sum_t total = 0;
+        for (auto [value, lower, upper] : sorted) {
+            lower = std::max(lower, 0);
+            upper = std::min(upper, size);
+            if (!cbounds.empty() && std::get<0>(cbounds.back()) == value) {
+                auto &[cvalue, clower, cupper] = cbounds.back();
+                static_cast<void>(cvalue);
+                total -= clower;
+                clower = std::max(clower, lower);
+                cupper = std::min(cupper, upper);
+                total += clower;
+            } else {
+                cbounds.emplace_back(value, lower, upper);
+                total += lower;
+            }
+        }
+        if (total > size) {
+            return cc_.add_clause({-lit});
+        }
+        for (auto [value, lower, upper] : cbounds) {
+            if (lower > upper) {
+                return cc_.add_clause({-lit});
+            }
+        }
+        cbounds.erase(std::remove_if(cbounds.begin(), cbounds.end(),
+                                     [size](auto const &bound) {
+                                         return std::get<1>(bound) == 0 && std::get<2>(bound) == size;
+                                     }),
+                      cbounds.end());
+
+        if (!cbounds.empty()) {
+            for (auto const &elem : elems) {
+                pin_(elem.first);
+            }
+            propagator_.add_constraint(
+                CountConstraint::create(lit, elems, cbounds, propagator_.config().sort_constraints));
+        }
+        return true;
+    }
+
+    //! Get a variable holding the maximum of the given terms.
+    //!
+    //! Terms not of form `a*x` are captured by auxiliary variables. Variables
+    //! are reused for terms and maxima that have been seen before. The bounds
+    //! of the variable are the maxima of the bounds of the terms.
+    [[nodiscard]] auto add_max(std::vector<std::pair<CoVarVec, val_t>> const &elems) -> var_t override {
+        CoVarVec celems;
+        celems.reserve(elems.size());
+        for (auto const &[elem, fixed] : elems) {
+            if (elem.size() == 1 && fixed == 0) {
+                celems.emplace_back(elem.front());
+            } else {
+                celems.emplace_back(1, add_term_(elem, fixed));
+            }
+        }
+        std::sort(celems.begin(), celems.end());
+        celems.erase(std::unique(celems.begin(), celems.end()), celems.end());
+
+        auto [it, ins] = max_vars_.try_emplace(celems, 0);
+        if (ins) {
+            it->second = propagator_.add_variable();
+            pin_(celems);
+            pinned_.emplace(it->second);
+            aux_vars_.emplace_back(it->second, [this, celems]() {
+                auto range = range_({celems.front()}, 0);
+                for (auto const &co_var : celems) {
+                    auto [lower, upper] = range_({co_var}, 0);
+                    range.first = std::max(range.first, lower);
+                    range.second = std::max(range.second, upper);
+                }
+                return range;
+            });
+            propagator_.add_constraint(MaxConstraint::create(TRUE_LIT, it->second, celems));
+        }
+        return it->second;
+    }
+
+    //! Get a variable holding the product of the given variables.
+    //!
+    //! Products are shared among all constraints. The bounds of the variable
+    //! are the extreme products of the bounds of the factors.
+    [[nodiscard]] auto add_mul(var_t var_a, var_t var_b) -> var_t override {
+        return add_mul_(var_a, var_b, [this, var_a, var_b]() {
+            auto [lower_a, upper_a] = get_bounds_(var_a);
+            auto [lower_b, upper_b] = get_bounds_(var_b);
+            return std::minmax({lower_a * lower_b, lower_a * upper_b, upper_a * lower_b, upper_a * upper_b});
+        });
+    }
+
+    //! Get a variable holding the quotient of the given terms.
+    //!
+    //! The absolute value of the quotient is bounded by the one of the
+    //! dividend.
+    [[nodiscard]] auto add_div(std::pair<CoVarVec, val_t> const &x, std::pair<CoVarVec, val_t> const &y)
+        -> var_t override {
+        auto var_x = term_var_(x);
+        auto var_y = term_var_(y);
+        auto [it, ins] = div_vars_.try_emplace(std::make_pair(var_x, var_y), 0);
+        if (ins) {
+            it->second = propagator_.add_variable();
+            pinned_.insert({var_x, var_y, it->second});
+            aux_vars_.emplace_back(it->second, [this, var_x]() {
+                auto [lower, upper] = get_bounds_(var_x);
+                auto bound = std::max(-lower, upper);
+                return std::make_pair(-bound, bound);
+            });
+            propagator_.add_constraint(std::make_unique<DivConstraint>(TRUE_LIT, var_x, var_y, it->second));
+        }
+        return it->second;
+    }
+
+    //! Get a variable holding the remainder of the division of the given
+    //! terms.
+    //!
+    //! The remainder is captured by the sum `x - y * (x / y)`, which is linear
+    //! if the divisor is a number. Because the division truncates toward
+    //! zero, the remainder has the sign of `x`, its absolute value is smaller
+    //! than the one of `y`, and the absolute value of `y * (x / y)` is bounded
+    //! by the one of `x`.
+    [[nodiscard]] auto add_mod(std::pair<CoVarVec, val_t> const &x, std::pair<CoVarVec, val_t> const &y)
+        -> var_t override {
+        auto var_q = add_div(x, y);
+        auto var_x = term_var_(x);
+        auto var_y = term_var_(y);
+        CoVarVec elems{x.first};
+        if (y.first.empty()) {
+            elems.emplace_back(safe_inv(y.second), var_q);
+        } else {
+            elems.emplace_back(-1, add_mul_(var_y, var_q, [this, var_x]() {
+                auto [lower, upper] = get_bounds_(var_x);
+                return std::make_pair(std::min<nsum_t>(lower, 0), std::max<nsum_t>(upper, 0));
+            }));
+        }
+        return add_term_(elems, x.second, [this, var_x, var_y]() {
+            auto [lower_x, upper_x] = get_bounds_(var_x);
+            auto [lower_y, upper_y] = get_bounds_(var_y);
+            auto bound_y = std::max<nsum_t>(std::max(-lower_y, upper_y) - 1, 0);
+            return std::make_pair(std::clamp<nsum_t>(lower_x, -bound_y, 0), std::clamp<nsum_t>(upper_x, 0, bound_y));
+        });
+    }
+
     static auto translate_disjoint_(var_t const &i, var_t const &j, val_t rhs) -> std::tuple<lit_t, CoVarVec, val_t> {
         CoVarVec elems;
         elems.emplace_back(1, i);
@@ -212,6 +598,7 @@ class ConstraintBuilder final : public AbstractConstraintBuilder {
         }
 
         if (elems.size() > 2) {
+            pin_(elems);
             propagator_.add_constraint(DisjointConstraint::create(lit, elems));
             return true;
         }
@@ -242,7 +629,11 @@ class ConstraintBuilder final : public AbstractConstraintBuilder {
     }
 
     [[nodiscard]] auto add_dom(lit_t lit, var_t var, IntervalSet<val_t> const &elems) -> bool override {
-        return cc_.assignment().is_false(lit) || propagator_.add_dom(cc_, lit, var, elems);
+        if (cc_.assignment().is_false(lit)) {
+            return true;
+        }
+        pinned_.emplace(var);
+        return propagator_.add_dom(cc_, lit, var, elems);
     }
 
     //! Prepare the minimize constraint.
@@ -263,11 +654,626 @@ class ConstraintBuilder final : public AbstractConstraintBuilder {
         return std::move(minimize_);
     }
 
+    //! Add the sum constraints gathered during parsing to the propagator.
+    //!
+    //! The bounds of auxiliary variables are determined first (see
+    //! ConstraintBuilder::bound_aux_). Then variables are aliased (see
+    //! ConstraintBuilder::alias_) and identical and complementary constraints
+    //! are merged (see ConstraintBuilder::merge_). Then a constraint is
+    //! dropped if there is another constraint over the same terms with a
+    //! smaller or equal rhs that either has the same literal or whose literal
+    //! is true.
+    [[nodiscard]] auto presolve() -> bool {
+        auto ass = cc_.assignment();
+        auto &stats = cc_.statistics();
+
+        std::vector<bool> removed(sums_.size(), false);
+        if (!bound_aux_() || !alias_(removed) || !merge_(removed)) {
+            return false;
+        }
+
+        std::vector<std::pair<CoVarVec, size_t>> keys;
+        keys.reserve(sums_.size());
+        for (size_t i = 0, e = sums_.size(); i != e; ++i) {
+            if (removed[i]) {
+                continue;
+            }
+            CoVarVec key{std::get<1>(sums_[i])};
+            std::sort(key.begin(), key.end(), [](auto a, auto b) { return a.second < b.second; });
+            keys.emplace_back(std::move(key), i);
+        }
+        std::sort(keys.begin(), keys.end(), [this](auto const &a, auto const &b) {
+            return std::tie(a.first, std::get<2>(sums_[a.second])) < std::tie(b.first, std::get<2>(sums_[b.second]));
+        });
+
+        std::unordered_set<lit_t> lits;
+        for (auto it = keys.begin(), ie = keys.end(); it != ie;) {
+            auto const &key = it->first;
+            auto jt = std::find_if(it, ie, [&key](auto const &x) { return x.first != key; });
+            bool fact = false;
+            lits.clear();
+            for (; it != jt; ++it) {
+                auto lit = std::get<0>(sums_[it->second]);
+                if (fact || !lits.emplace(lit).second) {
+                    removed[it->second] = true;
+                    ++stats.translate_dominated;
+                    continue;
+                }
+                fact = ass.is_true(lit);
+            }
+        }
+
+        for (uint32_t n = propagator_.config().subsum_limit; n > 0 && extract_(removed); --n) {
+            ++stats.translate_subsums;
+        }
+
+        for (size_t i = 0, e = sums_.size(); i != e; ++i) {
+            if (!removed[i]) {
+                auto const &[lit, elems, rhs] = sums_[i];
+                if (propagator_.config().probe_time > 0 && ass.is_true(lit)) {
+                    facts_.emplace_back(elems, rhs);
+                }
+                propagator_.add_constraint(
+                    SumConstraint::create(lit, rhs, elems, propagator_.config().sort_constraints));
+            }
+        }
+        sums_.clear();
+        return true;
+    }
+
+    //! Tighten the bounds of variables by probing their domains.
+    //!
+    //! A probe restricts a variable to the lower or upper half of its domain
+    //! and propagates the sum constraints that are facts. If this leads to a
+    //! conflict, the bound is tightened at the root level. Probes do not go
+    //! through the Solver, so conflicts that involve other constraints or
+    //! clauses are not detected. The configured time budget is shared among
+    //! the variables: each variable gets an equal part of the time remaining
+    //! when its probing starts.
+    [[nodiscard]] auto probe() -> bool {
+        using Clock = std::chrono::steady_clock;
+        auto deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                           std::chrono::duration<double>{propagator_.config().probe_time});
+
+        Prober prober;
+        for (auto const &[elems, rhs] : facts_) {
+            for (auto [co, var] : elems) {
+                static_cast<void>(co);
+                auto [lower, upper] = propagator_.get_bounds(var);
+                prober.add_variable(var, lower, upper);
+            }
+            prober.add_constraint(elems, rhs);
+        }
+        facts_.clear();
+
+        auto ret = prober.propagate();
+        auto vars = prober.variables();
+        for (size_t i = 0, n = vars.size(); ret && i != n; ++i) {
+            auto now = Clock::now();
+            if (now >= deadline) {
+                break;
+            }
+            ret = prober.bisect(std::get<0>(vars[i]), now + (deadline - now) / static_cast<Clock::rep>(n - i));
+        }
+        if (!ret) {
+            return cc_.add_clause({-TRUE_LIT});
+        }
+
+        auto &stats = cc_.statistics();
+        for (auto [var, lower, upper] : prober.variables()) {
+            auto [min_bound, max_bound] = propagator_.get_bounds(var);
+            if (upper < max_bound) {
+                ++stats.translate_probed;
+                if (!propagator_.add_simple(cc_, TRUE_LIT, 1, var, static_cast<val_t>(upper), false)) {
+                    return false;
+                }
+            }
+            if (lower > min_bound) {
+                ++stats.translate_probed;
+                if (!propagator_.add_simple(cc_, TRUE_LIT, -1, var, static_cast<val_t>(-lower), false)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
   private:
+    //! Get a variable holding the product of the given variables whose
+    //! bounds are computed by the given function.
+    auto add_mul_(var_t var_a, var_t var_b, AuxRange range) -> var_t {
+        auto [it, ins] = mul_vars_.try_emplace(std::make_pair(std::min(var_a, var_b), std::max(var_a, var_b)), 0);
+        if (ins) {
+            it->second = propagator_.add_variable();
+            pinned_.insert({var_a, var_b, it->second});
+            aux_vars_.emplace_back(it->second, std::move(range));
+            propagator_.add_constraint(
+                std::make_unique<NonlinearConstraint>(TRUE_LIT, 1, var_a, var_b, -1, it->second, 0));
+            propagator_.add_constraint(
+                std::make_unique<NonlinearConstraint>(TRUE_LIT, -1, var_a, var_b, 1, it->second, 0));
+        }
+        return it->second;
+    }
+
+    //! Get the bounds of a variable.
+    //!
+    //! This takes into account facts that have not been propagated yet and
+    //! the bounds computed for auxiliary variables.
+    auto get_bounds_(var_t var) -> std::pair<nsum_t, nsum_t> {
+        auto it = bounds_.find(var);
+        if (it != bounds_.end()) {
+            return it->second;
+        }
+        auto [lower, upper] = propagator_.get_bounds(var);
+        return {lower, upper};
+    }
+
+    //! Get the bounds of the sum of the given elements and constant.
+    auto range_(CoVarVec const &elems, nsum_t fixed) -> std::pair<nsum_t, nsum_t> {
+        auto lower = fixed;
+        auto upper = fixed;
+        for (auto [co, var] : elems) {
+            auto [lower_var, upper_var] = get_bounds_(var);
+            if (co > 0) {
+                lower += static_cast<nsum_t>(co) * lower_var;
+                upper += static_cast<nsum_t>(co) * upper_var;
+            } else {
+                lower += static_cast<nsum_t>(co) * upper_var;
+                upper += static_cast<nsum_t>(co) * lower_var;
+            }
+        }
+        return {lower, upper};
+    }
+
+    //! Compute the bounds of the auxiliary variables introduced during
+    //! parsing.
+    //!
+    //! Variables are processed in the order they have been introduced, so
+    //! that the bounds of the variables they depend on are already known.
+    //! Terms whose values do not fit into the supported range of values are
+    //! rejected.
+    auto bound_aux_() -> bool {
+        bounds_.clear();
+        for (auto const &[var, bounds] : propagator_.get_fact_bounds()) {
+            bounds_.emplace(var, bounds);
+        }
+        for (auto const &[var, range] : aux_vars_) {
+            auto [lower, upper] = range();
+            if (lower > upper) {
+                return cc_.add_clause({-TRUE_LIT});
+            }
+            if (lower < MIN_VAL || upper > MAX_VAL) {
+                throw std::overflow_error("term value out of range, restrict the domains of its variables");
+            }
+            bounds_.insert_or_assign(var, std::make_pair(lower, upper));
+            if (!propagator_.add_simple(cc_, TRUE_LIT, 1, var, static_cast<val_t>(upper), false) ||
+                !propagator_.add_simple(cc_, TRUE_LIT, -1, var, static_cast<val_t>(-lower), false)) {
+                return false;
+            }
+        }
+        aux_vars_.clear();
+        return true;
+    }
+
+    //! Mark the variables in the given elements as used by constraints that
+    //! cannot be presolved.
+    void pin_(CoVarVec const &elems) {
+        for (auto [co, var] : elems) {
+            static_cast<void>(co);
+            pinned_.emplace(var);
+        }
+    }
+
+    //! Check if a variable can be represented by another variable.
+    //!
+    //! This is only possible if the variable has been introduced in the
+    //! current step and only occurs in sum constraints.
+    [[nodiscard]] auto aliasable_(var_t var) const -> bool {
+        return var >= first_var_ && pinned_.find(var) == pinned_.end();
+    }
+
+    //! Get the representation `co*root+fixed` of a variable.
+    auto find_(var_t var) -> std::tuple<val_t, var_t, sum_t> {
+        auto it = aliases_.find(var);
+        if (it == aliases_.end()) {
+            return {1, var, 0};
+        }
+        auto [co, other, fixed] = it->second;
+        auto [co_r, root, fixed_r] = find_(other);
+        it->second = {co * co_r, root, co * fixed_r + fixed};
+        return it->second;
+    }
+
+    //! Alias variables according to `x = co*y+fixed`.
+    //!
+    //! Returns false if the variables already have the same representation,
+    //! none of them can be aliased, or the offset of a variable represented
+    //! by the new root would not be a valid value.
+    auto union_(var_t x, val_t co, var_t y, sum_t fixed) -> bool {
+        auto [co_x, root_x, fixed_x] = find_(x);
+        auto [co_y, root_y, fixed_y] = find_(y);
+        if (root_x == root_y) {
+            return false;
+        }
+        // root_x = co_r*root_y + fixed_r
+        val_t co_r = co_x * co * co_y;
+        sum_t fixed_r = co_x * (co * fixed_y + fixed - fixed_x);
+        // Note: Coefficients are either 1 or -1. Thus, the offsets of the
+        // variables represented by the aliased root change by at most
+        // fixed_r and stay within its spread.
+        auto spread_x = std::abs(fixed_r) + spread_[root_x];
+        auto spread_y = std::abs(fixed_r) + spread_[root_y];
+        if (aliasable_(root_x) && spread_x <= MAX_VAL) {
+            aliases_.emplace(root_x, std::make_tuple(co_r, root_y, fixed_r));
+            spread_[root_y] = std::max(spread_[root_y], spread_x);
+            return true;
+        }
+        if (aliasable_(root_y) && spread_y <= MAX_VAL) {
+            aliases_.emplace(root_y, std::make_tuple(co_r, root_x, -co_r * fixed_r));
+            spread_[root_x] = std::max(spread_[root_x], spread_y);
+            return true;
+        }
+        return false;
+    }
+
+    //! Replace aliased variables in the given elements.
+    //!
+    //! The constants introduced are added as elements with an invalid
+    //! variable.
+    auto substitute_(CoVarVec &elems) -> bool {
+        bool changed = false;
+        for (size_t i = 0, e = elems.size(); i != e; ++i) {
+            auto [co, var] = elems[i];
+            if (!is_valid_var(var)) {
+                continue;
+            }
+            auto [co_r, root, fixed] = find_(var);
+            if (root == var) {
+                continue;
+            }
+            elems[i] = {safe_mul(co, co_r), root};
+            // Note: union_ guarantees that the offset is a valid value.
+            elems.emplace_back(safe_mul(co, static_cast<val_t>(fixed)), INVALID_VAR);
+            changed = true;
+        }
+        return changed;
+    }
+
+    //! Alias variables linked by equalities of form `x + co*y = rhs` with
+    //! `co` either 1 or -1.
+    //!
+    //! Such equalities are given by two sum constraints with true literals.
+    //! One of the variables is replaced by `-co*y+rhs` or `-co*x+rhs`,
+    //! respectively, in all sum constraints and the minimize constraint. The
+    //! pair of variables then shares one order literal chain.
+    auto alias_(std::vector<bool> &removed) -> bool {
+        auto ass = cc_.assignment();
+
+        std::map<std::pair<CoVarVec, sum_t>, size_t> equations;
+        for (size_t i = 0, e = sums_.size(); i != e; ++i) {
+            auto const &[lit, elems, rhs] = sums_[i];
+            if (!ass.is_true(lit) || elems.size() != 2 || std::abs(elems[0].first) != 1 ||
+                std::abs(elems[1].first) != 1 || elems[0].second == elems[1].second) {
+                continue;
+            }
+            CoVarVec key{elems};
+            std::sort(key.begin(), key.end(), [](auto a, auto b) { return a.second < b.second; });
+            equations.emplace(std::make_pair(std::move(key), rhs), i);
+        }
+
+        for (auto const &[key, i] : equations) {
+            auto const &[elems, rhs] = key;
+            if (elems.front().first < 0) {
+                continue;
+            }
+            CoVarVec ielems{{-elems[0].first, elems[0].second}, {-elems[1].first, elems[1].second}};
+            auto it = equations.find(std::make_pair(ielems, -rhs));
+            if (it == equations.end()) {
+                continue;
+            }
+            if (union_(elems[0].second, -elems[1].first, elems[1].second, rhs)) {
+                removed[i] = true;
+                removed[it->second] = true;
+                ++cc_.statistics().translate_aliased;
+            }
+        }
+
+        if (aliases_.empty()) {
+            return true;
+        }
+
+        for (size_t i = 0, e = sums_.size(); i != e; ++i) {
+            auto &[lit, elems, rhs] = sums_[i];
+            if (!removed[i] && substitute_(elems)) {
+                rhs = safe_add(rhs, simplify(elems, true));
+            }
+        }
+        substitute_(minimize_elems_);
+
+        for (auto &[var, alias] : aliases_) {
+            auto [co, root, fixed] = find_(var);
+            if (!propagator_.add_alias(cc_, var, co, root, static_cast<val_t>(fixed))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! Merge sum constraints over the same elements and rhs.
+    //!
+    //! Constraints of form `l_i -> C` are replaced by a single constraint
+    //! `o -> C` where literal `o` is equivalent to the disjunction of the
+    //! `l_i`. Complementary constraints `l -> C` and `~l -> ~C` capture an
+    //! equivalence `l <-> C`. If there are several such equivalences, their
+    //! literals are made equivalent and only one pair of constraints is kept.
+    auto merge_(std::vector<bool> &removed) -> bool {
+        // group constraints together with their complements
+        std::unordered_map<std::pair<CoVarVec, sum_t>, size_t, SumHash> index;
+        std::vector<std::pair<std::vector<size_t>, std::vector<size_t>>> groups;
+        for (size_t i = 0, e = sums_.size(); i != e; ++i) {
+            std::pair<CoVarVec, sum_t> key{std::get<1>(sums_[i]), std::get<2>(sums_[i])};
+            std::sort(key.first.begin(), key.first.end(), [](auto a, auto b) { return a.second < b.second; });
+            bool neg = !key.first.empty() && key.first.front().first < 0;
+            if (neg) {
+                for (auto &co_var : key.first) {
+                    co_var.first = safe_inv(co_var.first);
+                }
+                key.second = -key.second - 1;
+            }
+            auto [it, ins] = index.try_emplace(std::move(key), groups.size());
+            if (ins) {
+                groups.emplace_back();
+            }
+            auto &group = groups[it->second];
+            (neg ? group.second : group.first).emplace_back(i);
+        }
+
+        for (auto &[pos, neg] : groups) {
+            if (pos.size() + neg.size() < 2) {
+                continue;
+            }
+            // make literals of equivalences equivalent
+            std::unordered_map<lit_t, size_t> neg_lits;
+            for (auto j : neg) {
+                neg_lits.emplace(std::get<0>(sums_[j]), j);
+            }
+            lit_t equiv = 0;
+            for (auto i : pos) {
+                auto lit = std::get<0>(sums_[i]);
+                auto it = neg_lits.find(-lit);
+                if (it == neg_lits.end() || removed[it->second]) {
+                    continue;
+                }
+                if (equiv == 0) {
+                    equiv = lit;
+                    continue;
+                }
+                if (!cc_.add_clause({-equiv, lit}) || !cc_.add_clause({equiv, -lit})) {
+                    return false;
+                }
+                removed[i] = true;
+                removed[it->second] = true;
+                cc_.statistics().translate_merged += 2;
+            }
+            // merge the remaining constraints into one
+            if (!merge_(pos, removed) || !merge_(neg, removed)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! Merge the given constraints over the same elements and rhs into one.
+    auto merge_(std::vector<size_t> &idx, std::vector<bool> &removed) -> bool {
+        idx.erase(std::remove_if(idx.begin(), idx.end(), [&removed](size_t i) { return removed[i]; }), idx.end());
+        if (idx.size() < 2) {
+            return true;
+        }
+
+        auto ass = cc_.assignment();
+        cc_.statistics().translate_merged += idx.size() - 1;
+
+        // a true literal subsumes all others
+        auto jt = std::find_if(idx.begin(), idx.end(), [&](size_t i) { return ass.is_true(std::get<0>(sums_[i])); });
+        if (jt != idx.end()) {
+            std::swap(*jt, idx.front());
+        } else {
+            auto lit = cc_.add_literal();
+            std::vector<lit_t> clause{-lit};
+            for (auto i : idx) {
+                auto &lit_i = std::get<0>(sums_[i]);
+                if (!cc_.add_clause({-lit_i, lit})) {
+                    return false;
+                }
+                clause.emplace_back(lit_i);
+            }
+            if (!cc_.add_clause(clause)) {
+                return false;
+            }
+            std::get<0>(sums_[idx.front()]) = lit;
+        }
+        for (auto it = idx.begin() + 1, ie = idx.end(); it != ie; ++it) {
+            removed[*it] = true;
+        }
+        return true;
+    }
+
+    //! Replace a sub-sum common to several sum constraints by an auxiliary
+    //! variable.
+    //!
+    //! The most frequent terms are paired with the term co-occurring with
+    //! them most often. The sub-sum consists of all terms shared by the
+    //! constraints containing the pair. It is only extracted if this
+    //! reduces the total number of terms including the defining equality
+    //! and the values of the sub-sum fit into the supported range of values.
+    auto extract_(std::vector<bool> &removed) -> bool {
+        std::map<co_var_t, std::vector<size_t>> occurrences;
+        for (size_t i = 0, e = sums_.size(); i != e; ++i) {
+            if (removed[i]) {
+                continue;
+            }
+            for (auto const &co_var : std::get<1>(sums_[i])) {
+                auto &occ = occurrences[co_var];
+                if (occ.empty() || occ.back() != i) {
+                    occ.emplace_back(i);
+                }
+            }
+        }
+        std::vector<std::pair<size_t, co_var_t>> order;
+        for (auto const &[co_var, occ] : occurrences) {
+            if (occ.size() > 1) {
+                order.emplace_back(occ.size(), co_var);
+            }
+        }
+        std::sort(order.begin(), order.end(), [](auto const &a, auto const &b) { return a.first > b.first; });
+
+        std::map<co_var_t, size_t> count;
+        std::vector<size_t> rows;
+        CoVarVec sub;
+        std::pair<nsum_t, nsum_t> range;
+        for (auto const &[size, first] : order) {
+            static_cast<void>(size);
+            auto const &occ = occurrences[first];
+            count.clear();
+            for (auto i : occ) {
+                for (auto const &co_var : std::get<1>(sums_[i])) {
+                    if (co_var != first) {
+                        ++count[co_var];
+                    }
+                }
+            }
+            auto jt = std::max_element(count.begin(), count.end(),
+                                       [](auto const &a, auto const &b) { return a.second < b.second; });
+            if (jt == count.end() || jt->second < 2) {
+                continue;
+            }
+            auto second = jt->first;
+            rows.clear();
+            for (auto i : occ) {
+                auto const &elems = std::get<1>(sums_[i]);
+                if (std::find(elems.begin(), elems.end(), second) != elems.end()) {
+                    rows.emplace_back(i);
+                }
+            }
+            count.clear();
+            for (auto i : rows) {
+                for (auto const &co_var : std::get<1>(sums_[i])) {
+                    ++count[co_var];
+                }
+            }
+            sub.clear();
+            for (auto const &[co_var, n] : count) {
+                if (n >= rows.size()) {
+                    sub.emplace_back(co_var);
+                }
+            }
+            // each occurrence saves |sub|-1 terms while the two defining
+            // constraints add |sub|+1 terms each
+            if (rows.size() * (sub.size() - 1) > 2 * (sub.size() + 1)) {
+                range = range_(sub, 0);
+                if (MIN_VAL <= range.first && range.first <= range.second && range.second <= MAX_VAL) {
+                    break;
+                }
+            }
+            sub.clear();
+        }
+        if (sub.empty()) {
+            return false;
+        }
+
+        auto var = propagator_.add_variable(static_cast<val_t>(range.first), static_cast<val_t>(range.second));
+        bounds_.emplace(var, range);
+        for (auto i : rows) {
+            auto &elems = std::get<1>(sums_[i]);
+            elems.erase(std::remove_if(elems.begin(), elems.end(),
+                                       [&sub](auto const &co_var) {
+                                           return std::binary_search(sub.begin(), sub.end(), co_var);
+                                       }),
+                        elems.end());
+            elems.emplace_back(1, var);
+        }
+        sub.emplace_back(-1, var);
+        add_sum_(TRUE_LIT, sub, 0);
+        for (auto &co_var : sub) {
+            co_var.first = safe_inv(co_var.first);
+        }
+        add_sum_(TRUE_LIT, std::move(sub), 0);
+        removed.resize(sums_.size(), false);
+        return true;
+    }
+
+    //! Buffer a sum constraint for presolving.
+    //!
+    //! Coefficients are divided by their greatest common divisor rounding
+    //! the rhs down.
+    void add_sum_(lit_t lit, CoVarVec elems, val_t rhs) {
+        val_t d = 0;
+        for (auto const &elem : elems) {
+            d = std::gcd(d, elem.first);
+        }
+        if (d > 1) {
+            for (auto &elem : elems) {
+                elem.first /= d;
+            }
+            rhs = floordiv(rhs, d);
+            ++cc_.statistics().translate_normalized;
+        }
+        sums_.emplace_back(lit, std::move(elems), rhs);
+    }
+
+    //! Get a variable equal to the given term reusing the variable if the
+    //! term is a variable.
+    auto term_var_(std::pair<CoVarVec, val_t> const &elem) -> var_t {
+        if (elem.first.size() == 1 && elem.first.front().first == 1 && elem.second == 0) {
+            return elem.first.front().second;
+        }
+        return add_term_(elem.first, elem.second);
+    }
+
+    //! Get a variable equal to the given term.
+    //!
+    //! Unless a function to compute tighter bounds is given, the bounds of
+    //! the variable are determined from the bounds of the variables in the
+    //! term.
+    auto add_term_(CoVarVec const &elems, val_t fixed, AuxRange range = nullptr) -> var_t {
+        auto [it, ins] = term_vars_.try_emplace(std::make_pair(elems, fixed), 0);
+        if (ins) {
+            // Note: the equality is added using sum constraints because they
+            // never fail to be added.
+            auto var = propagator_.add_variable();
+            if (range == nullptr) {
+                range = [this, elems, fixed]() { return range_(elems, fixed); };
+            }
+            aux_vars_.emplace_back(var, std::move(range));
+            CoVarVec celems{elems};
+            celems.emplace_back(-1, var);
+            add_sum_(TRUE_LIT, celems, safe_inv(fixed));
+            for (auto &co_var : celems) {
+                co_var.first = safe_inv(co_var.first);
+            }
+            add_sum_(TRUE_LIT, std::move(celems), fixed);
+            it->second = var;
+        }
+        return it->second;
+    }
+
     Propagator &propagator_;
     InitClauseCreator &cc_;
     UniqueMinimizeConstraint minimize_;
     CoVarVec minimize_elems_;
+    std::map<std::pair<CoVarVec, val_t>, var_t> term_vars_;
+    std::map<CoVarVec, var_t> max_vars_;
+    std::map<std::pair<var_t, var_t>, var_t> div_vars_;
+    std::map<std::pair<var_t, var_t>, var_t> mul_vars_;
+    std::vector<std::pair<var_t, AuxRange>> aux_vars_;
+    std::unordered_map<var_t, std::pair<nsum_t, nsum_t>> bounds_;
+    std::vector<std::tuple<lit_t, CoVarVec, val_t>> sums_;
+    std::unordered_map<var_t, std::tuple<val_t, var_t, sum_t>> aliases_;
+    //! The largest absolute offset of a variable represented by a root.
+    std::unordered_map<var_t, sum_t> spread_;
+    std::unordered_set<var_t> pinned_;
+    std::vector<std::pair<CoVarVec, val_t>> facts_;
+    var_t first_var_;
 };
 
 } // namespace
@@ -291,6 +1297,15 @@ void Propagator::on_model(Clingo::Model &model) {
         }
     }
 
+    if (config_.hint_model) {
+        auto &solver = solver_(model.thread_id());
+        for (var_t var = 0, n = solver.num_variables(); var < n; ++var) {
+            auto value = get_value(var, model.thread_id());
+            solver.set_hint(var, value);
+            hints_.insert_or_assign(var, value);
+        }
+    }
+
     model.extend(symbols_);
 }
 
@@ -320,6 +1335,7 @@ void Propagator::add_statistics_(Clingo::UserStatistics &root, Statistics &stats
     problem.add_subkey("Variables", StatisticsType::Value).set_value(static_cast<double>(stats.num_variables));
     problem.add_subkey("Clauses", StatisticsType::Value).set_value(static_cast<double>(stats.num_clauses));
     problem.add_subkey("Literals", StatisticsType::Value).set_value(static_cast<double>(stats.num_literals));
+    problem.add_subkey("Buffer peak", StatisticsType::Value).set_value(static_cast<double>(stats.buffer_peak));
 
     auto translate = clingcon.add_subkey("Translate", StatisticsType::Map);
     translate.add_subkey("Constraints removed", StatisticsType::Value)
@@ -330,6 +1346,28 @@ void Propagator::add_statistics_(Clingo::UserStatistics &root, Statistics &stats
     translate.add_subkey("Weight constraints", StatisticsType::Value)
         .set_value(static_cast<double>(stats.translate_wcs));
     translate.add_subkey("Literals", StatisticsType::Value).set_value(static_cast<double>(stats.translate_literals));
+    translate.add_subkey("Constraints normalized", StatisticsType::Value)
+        .set_value(static_cast<double>(stats.translate_normalized));
+    translate.add_subkey("Variables aliased", StatisticsType::Value)
+        .set_value(static_cast<double>(stats.translate_aliased));
+    translate.add_subkey("Equality literals reused", StatisticsType::Value)
+        .set_value(static_cast<double>(stats.translate_equal_hits));
+    translate.add_subkey("Translations skipped", StatisticsType::Value)
+        .set_value(static_cast<double>(stats.translate_skipped));
+    translate.add_subkey("Translations planned", StatisticsType::Value)
+        .set_value(static_cast<double>(stats.translate_planned));
+    translate.add_subkey("Translations rejected", StatisticsType::Value)
+        .set_value(static_cast<double>(stats.translate_rejected));
+    translate.add_subkey("Bounds probed", StatisticsType::Value)
+        .set_value(static_cast<double>(stats.translate_probed));
+    translate.add_subkey("Sub-sums extracted", StatisticsType::Value)
+        .set_value(static_cast<double>(stats.translate_subsums));
+    translate.add_subkey("Constraints merged", StatisticsType::Value)
+        .set_value(static_cast<double>(stats.translate_merged));
+    translate.add_subkey("Constraints dominated", StatisticsType::Value)
+        .set_value(static_cast<double>(stats.translate_dominated));
+    translate.add_subkey("Constraints redundant", StatisticsType::Value)
+        .set_value(static_cast<double>(stats.translate_redundant));
 
     UserStatistics threads = clingcon.add_subkey("Thread", StatisticsType::Array);
     threads.ensure_size(std::distance(stats.solver_statistics.begin(), stats.solver_statistics.end()),
@@ -351,6 +1389,8 @@ void Propagator::add_statistics_(Clingo::UserStatistics &root, Statistics &stats
             .set_value(static_cast<double>(solver_stat.introduced_reason));
         thread.add_subkey("Literals introduced", StatisticsType::Value)
             .set_value(static_cast<double>(solver_stat.literals));
+        thread.add_subkey("Constraints attached", StatisticsType::Value)
+            .set_value(static_cast<double>(solver_stat.attached));
     }
 }
 
@@ -366,6 +1406,13 @@ auto Propagator::add_variable(Clingo::Symbol sym) -> var_t {
     return it->second;
 }
 
+auto Propagator::add_variable() -> var_t { return add_variable(MIN_VAL, MAX_VAL); }
+
+auto Propagator::add_variable(val_t min_int, val_t max_int) -> var_t {
+    ++stats_step_.num_variables;
+    return master_().add_variable(min_int, max_int);
+}
+
 void Propagator::show_variable(var_t var) { show_variable_.emplace(var); }
 
 void Propagator::show_signature(char const *name, size_t arity) { show_signature_.emplace(name, arity); }
@@ -391,7 +1438,7 @@ void Propagator::init(Clingo::PropagateInit &init) {
     init.set_check_mode(Clingo::PropagatorCheckMode::Partial);
 
     Timer timer{stats_step_.time_init};
-    InitClauseCreator cc{init, stats_step_};
+    InitClauseCreator cc{init, stats_step_, config_.buffer_limit};
 
     // remove minimize constraint
     UniqueMinimizeConstraint minimize{remove_minimize()};
@@ -401,9 +1448,39 @@ void Propagator::init(Clingo::PropagateInit &init) {
         solver.update();
     }
 
+    // keep constraints added while solving
+    for (auto &constraint : lazy_constraints_) {
+        add_constraint(std::move(constraint));
+    }
+    lazy_constraints_.clear();
+    lazy_size_ = 0;
+
+    // restore aliased variables
+    for (auto const &[var, alias] : aliases_) {
+        auto [co, other, fixed] = alias;
+        for (auto &solver : solvers_) {
+            solver.alias_variable(var, false);
+        }
+        CoVarVec elems{{1, var}, {safe_inv(co), other}};
+        add_constraint(SumConstraint::create(TRUE_LIT, fixed, elems, config_.sort_constraints));
+        for (auto &co_var : elems) {
+            co_var.first = safe_inv(co_var.first);
+        }
+        add_constraint(SumConstraint::create(TRUE_LIT, safe_inv(fixed), elems, config_.sort_constraints));
+    }
+    aliases_.clear();
+
+    // pass hints to the master before order literals are introduced
+    for (auto [var, value] : hints_) {
+        master_().set_hint(var, value);
+    }
+
     // add constraints
     ConstraintBuilder builder{*this, cc, std::move(minimize)};
-    if (!parse(builder, init.theory_atoms())) {
+    if (!parse(builder, init.theory_atoms()) || !add_queued_(builder)) {
+        return;
+    }
+    if (!builder.presolve()) {
         return;
     }
 
@@ -411,6 +1488,15 @@ void Propagator::init(Clingo::PropagateInit &init) {
     solvers_.reserve(init.number_of_threads());
     auto &master = master_();
 
+    // pass hints of aliased variables to their representatives
+    for (auto [var, value] : hints_) {
+        if (auto it = aliases_.find(var); it != aliases_.end()) {
+            auto [co, other, fixed] = it->second;
+            auto hint = std::clamp<sum_t>(co * (static_cast<sum_t>(value) - fixed), MIN_VAL, MAX_VAL);
+            master.set_hint(other, static_cast<val_t>(hint));
+        }
+    }
+
     // gather bounds of states in master
     for (auto it = solvers_.begin() + 1, ie = solvers_.end(); it != ie; ++it) {
         if (!master.update_bounds(cc, *it, config_.check_state)) {
@@ -423,6 +1509,11 @@ void Propagator::init(Clingo::PropagateInit &init) {
         return;
     }
 
+    // tighten bounds by probing and propagate them
+    if (config_.probe_time > 0 && (!builder.probe() || !simplify_(cc))) {
+        return;
+    }
+
     // translate (simple enough) constraints
     if (!translate_(cc, builder.prepare_minimize())) {
         return;
@@ -444,6 +1535,7 @@ void Propagator::init(Clingo::PropagateInit &init) {
     while (solvers_.size() > n) {
         solvers_.pop_back();
     }
+    lazy_offsets_.assign(n, 0);
     master.shrink_to_fit();
     for (auto it = solvers_.begin() + 1, ie = solvers_.end(); it != ie; ++it) {
         it->copy_state(master);
@@ -453,8 +1545,9 @@ void Propagator::init(Clingo::PropagateInit &init) {
     // to the model lock too.
     if (has_minimize()) {
         init.set_check_mode(Clingo::PropagatorCheckMode::Both);
-        update_minimize(no_bound);
+        update_minimize(initial_bound_);
     }
+    initial_bound_ = no_bound;
 
     auto max_var = static_cast<var_t>(cc.assignment().size());
     for (auto &solver : solvers_) {
@@ -462,6 +1555,33 @@ void Propagator::init(Clingo::PropagateInit &init) {
     }
 }
 
+void Propagator::queue_sum(lit_t lit, CoVarVec elems, val_t rhs, bool strict) {
+    queued_sums_.emplace_back(lit, std::move(elems), rhs, strict);
+}
+
+void Propagator::queue_distinct(lit_t lit, std::vector<std::pair<CoVarVec, val_t>> elems) {
+    queued_distinct_.emplace_back(lit, std::move(elems));
+}
+
+auto Propagator::add_queued_(AbstractConstraintBuilder &builder) -> bool {
+    auto sums = std::move(queued_sums_);
+    auto distinct = std::move(queued_distinct_);
+    queued_sums_.clear();
+    queued_distinct_.clear();
+
+    for (auto const &[lit, elems, rhs, strict] : sums) {
+        if (!builder.add_constraint(builder.solver_literal(lit), elems, rhs, strict)) {
+            return false;
+        }
+    }
+    for (auto const &[lit, elems] : distinct) {
+        if (!builder.add_distinct(builder.solver_literal(lit), elems)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 auto Propagator::simplify_(AbstractClauseCreator &cc) -> bool {
     Timer timer{stats_step_.time_simplify};
     struct Reset { // NOLINT
@@ -484,6 +1604,13 @@ auto Propagator::translate_(InitClauseCreator &cc, UniqueMinimizeConstraint mini
         add_minimize_(std::move(minimize));
     }
 
+    // pass the objective to the master for the objective heuristic
+    CoVarVec objective;
+    if (minimize_ != nullptr) {
+        objective.assign(minimize_->begin(), minimize_->end());
+    }
+    master_().set_objective(std::move(objective));
+
     // translate (simple enough) constraints
     cc.set_state(InitState::Translate);
     bool ret = master_().translate(cc, stats_step_, config_, constraints_);
@@ -509,7 +1636,8 @@ void Propagator::propagate(Clingo::PropagateControl &control, Clingo::LiteralSpa
 void Propagator::check(Clingo::PropagateControl &control) {
     auto ass = control.assignment();
     auto size = ass.size();
-    auto &solver = solver_(control.thread_id());
+    auto thread_id = control.thread_id();
+    auto &solver = solver_(thread_id);
     auto dl = ass.decision_level();
 
     if (minimize_ != nullptr) {
@@ -522,6 +1650,7 @@ void Propagator::check(Clingo::PropagateControl &control) {
 
     ControlClauseCreator cc{control, solver.statistics()};
 
+    integrate_lazy_(solver, thread_id);
     if (!solver.check(cc, config_.check_state)) {
         return;
     }
@@ -533,6 +1662,49 @@ void Propagator::check(Clingo::PropagateControl &control) {
     // variables are watched.
     if (size == ass.size() && ass.is_total()) {
         solver.check_full(cc, config_.check_solution);
+
+        // Note: The callback is only called if check_full did not introduce
+        // order literals for unassigned variables. Constraints added by the
+        // callback are propagated right away. If they are violated, this
+        // leads to a conflict.
+        if (check_callback_ && size == ass.size() && ass.is_total()) {
+            check_callback_(thread_id);
+            integrate_lazy_(solver, thread_id);
+            if (solver.has_lazy_constraints()) {
+                static_cast<void>(solver.check(cc, config_.check_state));
+            }
+        }
+    }
+}
+
+void Propagator::add_lazy_sum(CoVarVec elems, val_t rhs) {
+    // replace aliased variables by their representation
+    sum_t fixed = 0;
+    for (auto &[co, var] : elems) {
+        if (auto it = aliases_.find(var); it != aliases_.end()) {
+            auto [co_a, other, fixed_a] = it->second;
+            fixed = safe_add<sum_t>(fixed, static_cast<sum_t>(co) * fixed_a);
+            co = safe_mul(co, co_a);
+            var = other;
+        }
+    }
+    auto shift = simplify(elems, true);
+    rhs = check_valid_value(safe_add<sum_t>(safe_sub<sum_t>(rhs, fixed), shift));
+
+    auto constraint = SumConstraint::create(TRUE_LIT, rhs, elems, config_.sort_constraints);
+    std::lock_guard<std::mutex> guard{lazy_mutex_};
+    lazy_constraints_.emplace_back(std::move(constraint));
+    lazy_size_.store(lazy_constraints_.size(), std::memory_order_release);
+}
+
+void Propagator::integrate_lazy_(Solver &solver, uint32_t thread_id) {
+    auto &offset = lazy_offsets_[thread_id];
+    if (offset == lazy_size_.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard{lazy_mutex_};
+    for (auto ie = lazy_constraints_.size(); offset < ie; ++offset) {
+        solver.add_lazy_constraint(*lazy_constraints_[offset]);
     }
 }
 
@@ -579,7 +1751,38 @@ auto Propagator::get_symbol(var_t var) const -> std::optional<Clingo::Symbol> {
     return std::nullopt;
 }
 
-auto Propagator::get_value(var_t var, uint32_t thread_id) const -> val_t { return solver_(thread_id).get_value(var); }
+auto Propagator::get_value(var_t var, uint32_t thread_id) const -> val_t {
+    if (auto it = aliases_.find(var); it != aliases_.end()) {
+        auto [co, other, fixed] = it->second;
+        return co * solver_(thread_id).get_value(other) + fixed;
+    }
+    return solver_(thread_id).get_value(var);
+}
+
+auto Propagator::get_bounds(var_t var) -> std::pair<val_t, val_t> {
+    auto &vs = master_().var_state(var);
+    return {vs.lower_bound(), vs.upper_bound()};
+}
+
+auto Propagator::get_fact_bounds() -> std::unordered_map<var_t, std::pair<val_t, val_t>> {
+    return master_().fact_bounds();
+}
+
+auto Propagator::add_alias(AbstractClauseCreator &cc, var_t var, val_t co, var_t other, val_t fixed) -> bool {
+    assert(co == 1 || co == -1);
+    auto &master = master_();
+    auto &vs = master.var_state(var);
+    auto lower = static_cast<sum_t>(vs.lower_bound()) - fixed;
+    auto upper = static_cast<sum_t>(vs.upper_bound()) - fixed;
+
+    aliases_.insert_or_assign(var, std::make_tuple(co, other, fixed));
+    master.alias_variable(var, true);
+
+    // the value of co*other must be within [lower, upper]
+    auto clamp = [](sum_t value) { return static_cast<val_t>(std::clamp<sum_t>(value, MIN_VAL - 1, MAX_VAL)); };
+    return add_simple(cc, TRUE_LIT, co, other, clamp(upper), false) &&
+           add_simple(cc, TRUE_LIT, safe_inv(co), other, clamp(-lower), false);
+}
 
 void Propagator::add_minimize_(UniqueMinimizeConstraint minimize) {
     assert(minimize_ == nullptr);
@@ -26,6 +26,7 @@
 #include "clingcon/util.hh"
 
 #include <clingo.hh>
+#include <iostream>
 #include <unordered_set>
 
 namespace Clingcon {
@@ -35,7 +36,8 @@ class Solver::Level {
   public:
     Level(Solver &solver, level_t level)
         : level_{level}, undo_lower_offset_{solver.undo_lower_.size()}, undo_upper_offset_{solver.undo_upper_.size()},
-          inactive_offset_{solver.inactive_.size()}, removed_var_watches_offset_{solver.removed_var_watches_.size()} {}
+          inactive_offset_{solver.inactive_.size()}, removed_var_watches_offset_{solver.removed_var_watches_.size()},
+          attached_offset_{solver.attached_.size()} {}
 
     [[nodiscard]] auto level() const -> level_t { return level_; }
 
@@ -45,6 +47,8 @@ class Solver::Level {
         if (level_ > 0 && !vs.pushed_lower(level_)) {
             vs.push_lower(level_);
             solver.undo_lower_.emplace_back(vs.var());
+        } else if (level_ == 0) {
+            solver.root_changed_.emplace(vs.var());
         }
         vs.lower_bound(value + 1);
 
@@ -61,6 +65,8 @@ class Solver::Level {
         if (level_ > 0 && !vs.pushed_upper(level_)) {
             vs.push_upper(level_);
             solver.undo_upper_.emplace_back(vs.var());
+        } else if (level_ == 0) {
+            solver.root_changed_.emplace(vs.var());
         }
         vs.upper_bound(value);
 
@@ -98,6 +104,18 @@ class Solver::Level {
         }
     }
 
+    //! Attach a constraint state that has been detached lazily.
+    void attach(Solver &solver, AbstractConstraintState &cs) const {
+        solver.detached_.erase(&cs);
+        cs.attach(solver);
+        if (solver.ever_attached_.emplace(&cs.constraint()).second) {
+            ++solver.stats_.attached;
+        }
+        if (level_ > 0) {
+            solver.attached_.emplace_back(&cs);
+        }
+    }
+
     //! Add the given constraint state to the todo list if it is not yet
     //! contained.
     static void mark_todo(Solver &solver, AbstractConstraintState &cs) {
@@ -171,6 +189,16 @@ class Solver::Level {
         }
         solver.removed_var_watches_.resize(removed_var_watches_offset_);
 
+        // detach lazily attached constraints
+        // Note: This has to happen after the watches have been restored.
+        for (auto it = solver.attached_.begin() + static_cast<ptrdiff_t>(attached_offset_), ie = solver.attached_.end();
+             it != ie; ++it) {
+            auto *cs = *it;
+            cs->detach(solver);
+            solver.detached_.emplace(cs);
+        }
+        solver.attached_.resize(attached_offset_);
+
         // clear remaining todo items
         for (auto *cs : solver.todo_) {
             cs->mark_todo(false);
@@ -265,6 +293,10 @@ class Solver::Level {
             solver.removed_var_watches_.emplace_back(var, val, &solver.constraint_state(cs->constraint()));
         }
 
+        // lazily attached constraints are only recorded above level zero
+        lvl.attached_offset_ = 0;
+        solver.attached_.clear();
+
         // copy todo queue
         solver.todo_.clear();
         solver.todo_.reserve(master.todo_.size());
@@ -280,6 +312,7 @@ class Solver::Level {
     size_t undo_upper_offset_;
     size_t inactive_offset_;
     size_t removed_var_watches_offset_;
+    size_t attached_offset_;
 };
 
 //! Helper class to efficiently handle order literal lookups
@@ -355,8 +388,13 @@ Solver::Solver(Solver &&x) noexcept
       litmap_{std::move(x.litmap_)}, factmap_{std::move(x.factmap_)}, c2cs_{std::move(x.c2cs_)},
       var_watches_{std::move(x.var_watches_)}, udiff_{std::move(x.udiff_)}, in_udiff_{std::move(x.in_udiff_)},
       ldiff_{std::move(x.ldiff_)}, in_ldiff_{std::move(x.in_ldiff_)}, todo_{std::move(x.todo_)},
-      lit2cs_{std::move(x.lit2cs_)}, temp_reason_{std::move(x.temp_reason_)}, split_last_{x.split_last_},
-      trail_offset_{x.trail_offset_}, minimize_bound_{std::move(x.minimize_bound_)},
+      lit2cs_{std::move(x.lit2cs_)}, attached_{std::move(x.attached_)}, detached_{std::move(x.detached_)},
+      ever_attached_{std::move(x.ever_attached_)}, aliased_{std::move(x.aliased_)},
+      equal_literals_{std::move(x.equal_literals_)}, translated_{std::move(x.translated_)},
+      step_literals_{std::move(x.step_literals_)},
+      root_changed_{std::move(x.root_changed_)}, lazy_{std::move(x.lazy_)}, hints_{std::move(x.hints_)},
+      objective_{std::move(x.objective_)}, temp_reason_{std::move(x.temp_reason_)}, split_last_{x.split_last_},
+      objective_last_{x.objective_last_}, trail_offset_{x.trail_offset_}, minimize_bound_{std::move(x.minimize_bound_)},
       minimize_level_{x.minimize_level_} {}
 #else
 Solver::Solver(Solver &&x) noexcept = default;
@@ -381,6 +419,7 @@ void Solver::shrink_to_fit() {
 void Solver::copy_state(Solver const &master) {
     // just to be thorough
     split_last_ = master.split_last_;
+    objective_last_ = 0;
     trail_offset_ = master.trail_offset_;
     minimize_level_ = master.minimize_level_;
     minimize_bound_ = master.minimize_bound_;
@@ -389,6 +428,14 @@ void Solver::copy_state(Solver const &master) {
     var2vs_ = master.var2vs_;
     factmap_ = master.factmap_;
     litmap_ = master.litmap_;
+    aliased_ = master.aliased_;
+    equal_literals_ = master.equal_literals_;
+    step_literals_ = master.step_literals_;
+    root_changed_.clear();
+    translated_.clear();
+    lazy_.clear();
+    hints_ = master.hints_;
+    objective_ = master.objective_;
 
     // copy constraint states and lookups
     c2cs_.clear();
@@ -399,6 +446,14 @@ void Solver::copy_state(Solver const &master) {
         auto ret = c2cs_.emplace(c, cs->copy());
         lit2cs_.emplace(c->literal(), ret.first->second.get());
     }
+    detached_.clear();
+    detached_.reserve(master.detached_.size());
+    for (auto *cs : master.detached_) {
+        detached_.emplace(&constraint_state(cs->constraint()));
+    }
+    for (auto it = ever_attached_.begin(); it != ever_attached_.end();) {
+        it = c2cs_.find(*it) == c2cs_.end() ? ever_attached_.erase(it) : std::next(it);
+    }
 
     // adjust levels
     Level::copy_state(*this, master);
@@ -413,6 +468,36 @@ auto Solver::add_variable(val_t min_int, val_t max_int) -> var_t {
     return idx;
 }
 
+auto Solver::fact_bounds() const -> std::unordered_map<var_t, std::pair<val_t, val_t>> {
+    std::unordered_map<var_t, std::pair<val_t, val_t>> bounds;
+    for (auto [lit, var, value, prec_lit] : factmap_) {
+        static_cast<void>(prec_lit);
+        auto const &vs = var_state(var);
+        auto &[lower, upper] = bounds.try_emplace(var, vs.lower_bound(), vs.upper_bound()).first->second;
+        if (lit == TRUE_LIT) {
+            upper = std::min(upper, value);
+        } else {
+            lower = std::max(lower, value + 1);
+        }
+    }
+    return bounds;
+}
+
+void Solver::alias_variable(var_t var, bool aliased) {
+    if (aliased) {
+        aliased_.emplace(var);
+    } else {
+        aliased_.erase(var);
+    }
+}
+
+void Solver::set_objective(CoVarVec objective) {
+    objective_ = std::move(objective);
+    objective_last_ = 0;
+    std::stable_sort(objective_.begin(), objective_.end(),
+                     [](co_var_t const &a, co_var_t const &b) { return std::abs(a.first) > std::abs(b.first); });
+}
+
 auto Solver::minimize_bound() const -> std::optional<sum_t> { return minimize_bound_; }
 
 void Solver::update_minimize(AbstractConstraint &constraint, level_t level, sum_t bound) {
@@ -453,6 +538,7 @@ void Solver::litmap_add_(VarState &vs, val_t val, lit_t lit) {
     }
     auto ps = update_litmap_(vs, lit, val);
     litmap_[offset] = LitmapEntry{lit, vs.var(), val, ps.first, ps.second};
+    step_literals_.emplace_back(lit);
 }
 
 auto Solver::get_literal(AbstractClauseCreator &cc, VarState &vs, val_t value) -> lit_t {
@@ -468,8 +554,9 @@ auto Solver::get_literal(AbstractClauseCreator &cc, VarState &vs, val_t value) -
         // Note: By default clasp's heuristic makes literals false. By flipping
         // the literal for non-negative values, assignments close to zero are
         // preferred. This way, we might get solutions with small numbers
-        // first.
-        if (value >= config().sign_value) {
+        // first. Hints take precedence over the configured sign value.
+        auto it = hints_.find(vs.var());
+        if (value >= (it != hints_.end() ? it->second : config().sign_value)) {
             lit = -lit;
         }
         litmap_add_(vs, value, lit);
@@ -479,6 +566,32 @@ auto Solver::get_literal(AbstractClauseCreator &cc, VarState &vs, val_t value) -
     return lit;
 }
 
+auto Solver::get_equal_literal(InitClauseCreator &cc, VarState &vs, val_t value) -> std::pair<bool, lit_t> {
+    // lit == var<=value && var>=value
+    //     == var<=value && not var<=value-1
+    auto a = get_literal(cc, vs, value);
+    auto b = -get_literal(cc, vs, value - 1);
+
+    if (a == -TRUE_LIT || b == -TRUE_LIT) {
+        return {true, -TRUE_LIT};
+    }
+    if (a == TRUE_LIT) {
+        return {true, b};
+    }
+    if (b == TRUE_LIT) {
+        return {true, a};
+    }
+
+    auto [it, ins] = equal_literals_.try_emplace(std::make_pair(vs.var(), value), 0);
+    if (!ins) {
+        ++cc.statistics().translate_equal_hits;
+        return {true, it->second};
+    }
+    auto lit = cc.add_literal();
+    it->second = lit;
+    return {cc.add_clause({-a, -b, lit}) && cc.add_clause({a, -lit}) && cc.add_clause({b, -lit}), lit};
+}
+
 auto Solver::update_litmap_(VarState &vs, lit_t lit, val_t value) -> std::pair<lit_t, lit_t> {
     std::pair<lit_t, lit_t> ret{-TRUE_LIT, TRUE_LIT};
     if (auto prev = vs.lit_lt(value); prev != 0) {
@@ -540,6 +653,21 @@ auto Solver::add_constraint(AbstractConstraint &constraint) -> AbstractConstrain
         lit2cs_.emplace(constraint.literal(), cs.get());
         cs->attach(*this);
         Level::mark_todo(*this, *cs);
+    } else if (detached_.erase(cs.get()) > 0) {
+        cs->attach(*this);
+        Level::mark_todo(*this, *cs);
+    }
+
+    return *cs;
+}
+
+auto Solver::add_detached_(AbstractConstraint &constraint) -> AbstractConstraintState & {
+    auto &cs = c2cs_.emplace(&constraint, std::unique_ptr<AbstractConstraintState>{nullptr}).first->second;
+
+    if (cs == nullptr) {
+        cs = constraint.create_state();
+        lit2cs_.emplace(constraint.literal(), cs.get());
+        detached_.emplace(cs.get());
     }
 
     return *cs;
@@ -549,7 +677,9 @@ void Solver::remove_constraint(AbstractConstraint &constraint) {
     auto lit = constraint.literal();
     auto it = c2cs_.find(&constraint);
     auto &cs = *it->second;
-    cs.detach(*this);
+    if (detached_.erase(&cs) == 0) {
+        cs.detach(*this);
+    }
 
     for (auto it = lit2cs_.find(lit), ie = lit2cs_.end(); it != ie && it->first == lit; ++it) {
         if (it->second == &cs) {
@@ -559,11 +689,41 @@ void Solver::remove_constraint(AbstractConstraint &constraint) {
     }
 
     level_().remove_constraint(*this, cs);
+    translated_.erase(&cs);
+    ever_attached_.erase(&constraint);
     c2cs_.erase(it);
 }
 
 auto Solver::translate(InitClauseCreator &cc, Statistics &stats, Config const &conf, ConstraintVec &constraints)
     -> bool {
+    // constraints have to be attached for translation
+    for (auto *cs : detached_) {
+        cs->attach(*this);
+    }
+    detached_.clear();
+
+    // Note: Constraints kept in a previous step are only translated again if
+    // the bounds of one of their variables changed on the top level.
+    for (auto var : root_changed_) {
+        for (auto const &value_cs : var_watches_[var]) {
+            translated_.erase(value_cs.second);
+        }
+    }
+
+    // Note: Planned constraints are translated regardless of the total clause
+    // limit while all others are only translated to clauses if added during
+    // translation.
+    std::unordered_set<AbstractConstraintState *> planned;
+    std::optional<Config> plan_conf;
+    std::optional<Config> skip_conf;
+    if (conf.translate_plan) {
+        planned = plan_translation_(cc, stats, conf, constraints);
+        plan_conf.emplace(conf);
+        plan_conf->clause_limit_total = std::numeric_limits<uint64_t>::max();
+        skip_conf.emplace(conf);
+        skip_conf->clause_limit_total = 0;
+    }
+
     size_t jdx = 0, kdx = constraints.size(); // NOLINT
     for (size_t idx = jdx; idx < constraints.size(); ++idx) {
         auto &cs = add_constraint(*constraints[idx]);
@@ -571,9 +731,20 @@ auto Solver::translate(InitClauseCreator &cc, Statistics &stats, Config const &c
             ++stats.num_constraints;
             ++stats.translate_added;
         }
-        auto ret = cs.translate(conf, *this, cc, constraints);
-        if (!ret.first) {
-            return false;
+        auto truth = cc.assignment().truth_value(constraints[idx]->literal());
+        auto ret = std::make_pair(true, false);
+        if (unchanged_(cs, truth)) {
+            ++stats.translate_skipped;
+        } else {
+            auto const *cs_conf = &conf;
+            if (conf.translate_plan && idx < kdx) {
+                cs_conf = planned.count(&cs) > 0 ? &*plan_conf : &*skip_conf;
+            }
+            ret = cs.translate(*cs_conf, *this, cc, constraints);
+            if (!ret.first || !cc.flush()) {
+                return false;
+            }
+            translated_.insert_or_assign(&cs, truth);
         }
         if (ret.second) {
             --stats.num_constraints;
@@ -610,12 +781,27 @@ auto Solver::translate(InitClauseCreator &cc, Statistics &stats, Config const &c
             }
         }
         for (auto it = constraints.begin() + static_cast<ptrdiff_t>(jdx), ie = constraints.end(); it != ie; ++it) {
+            translated_.erase(&constraint_state(**it));
+            ever_attached_.erase(it->get());
             c2cs_.erase(it->get());
         }
     }
 
     constraints.erase(constraints.begin() + static_cast<ptrdiff_t>(jdx), constraints.end());
 
+    // Note: Constraint literals are watched by the propagator and such
+    // constraints are only attached again once their literal becomes true.
+    if (conf.lazy_attach) {
+        auto ass = cc.assignment();
+        for (auto &constraint : constraints) {
+            auto &cs = constraint_state(*constraint);
+            if (cs.detachable() && !ass.is_true(constraint->literal())) {
+                cs.detach(*this);
+                detached_.emplace(&cs);
+            }
+        }
+    }
+
     // This readds binary clauses when multishot-solving. Probably clasp can
     // handle this.
     if (conf.add_order_clauses) {
@@ -640,6 +826,51 @@ auto Solver::translate(InitClauseCreator &cc, Statistics &stats, Config const &c
     return true;
 }
 
+auto Solver::plan_translation_(InitClauseCreator &cc, Statistics &stats, Config const &conf,
+                               ConstraintVec &constraints) -> std::unordered_set<AbstractConstraintState *> {
+    std::vector<std::tuple<double, uint64_t, AbstractConstraintState *>> candidates;
+    for (auto &constraint : constraints) {
+        // Note: The states are attached when translating the constraints.
+        auto &cs = add_detached_(*constraint);
+        if (unchanged_(cs, cc.assignment().truth_value(constraint->literal()))) {
+            continue;
+        }
+        if (auto estimate = cs.translation_estimate(conf, *this, cc); estimate.has_value()) {
+            auto [clauses, cost] = *estimate;
+            candidates.emplace_back(cost / static_cast<double>(clauses + 1), clauses, &cs);
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](auto const &a, auto const &b) { return std::get<0>(a) > std::get<0>(b); });
+
+    std::unordered_set<AbstractConstraintState *> planned;
+    uint64_t budget = 0;
+    if (conf.clause_limit_total > stats.translate_clauses) {
+        budget = conf.clause_limit_total - stats.translate_clauses;
+    }
+    for (auto [ratio, clauses, cs] : candidates) {
+        bool accept = clauses <= budget;
+        if (accept) {
+            budget -= clauses;
+            planned.emplace(cs);
+            ++stats.translate_planned;
+        } else {
+            ++stats.translate_rejected;
+        }
+        if (conf.log_plan) {
+            std::cerr << "clingcon: " << (accept ? "planned" : "rejected") << " constraint with literal "
+                      << cs->constraint().literal() << ": " << clauses << " clauses, cost per clause " << ratio
+                      << ", remaining budget " << budget << "\n";
+        }
+    }
+    return planned;
+}
+
+auto Solver::unchanged_(AbstractConstraintState &cs, Clingo::TruthValue truth) const -> bool {
+    auto it = translated_.find(&cs);
+    return it != translated_.end() && it->second == truth;
+}
+
 auto Solver::simplify(AbstractClauseCreator &cc, bool check_state) -> bool {
     auto ass = cc.assignment();
     auto trail = ass.trail();
@@ -833,9 +1064,10 @@ auto Solver::check(AbstractClauseCreator &cc, bool check_state) -> bool {
     auto &lvl = level_();
 
     // Note: Most of the time check has to be called only for levels that have
-    // also been propagated. The exception is if a minimize constraint has to
-    // be integrated when backtracking from a bound update.
-    if (ass.decision_level() != lvl.level() && lvl.level() >= minimize_level_) {
+    // also been propagated. The exceptions are if a minimize constraint has
+    // to be integrated when backtracking from a bound update or if
+    // constraints have been added while solving.
+    if (ass.decision_level() != lvl.level() && lvl.level() >= minimize_level_ && lazy_.empty()) {
         return true;
     }
 
@@ -864,6 +1096,14 @@ auto Solver::check(AbstractClauseCreator &cc, bool check_state) -> bool {
         }
         in_ldiff_.clear();
 
+        // add constraints added while solving
+        // Note: This has to happen after updating the bounds because the
+        // states of the constraints are initialized with the current bounds.
+        for (auto *constraint : lazy_) {
+            add_constraint(*constraint);
+        }
+        lazy_.clear();
+
         // propagate affected constraints
         bool ret{true};
         for (auto *cs : todo_) {
@@ -872,12 +1112,19 @@ auto Solver::check(AbstractClauseCreator &cc, bool check_state) -> bool {
                 continue;
             }
 
-            if (!ass.is_false(cs->constraint().literal())) {
-                if (!cs->propagate(*this, cc, check_state)) {
-                    ret = false;
-                }
-            } else {
+            auto lit = cs->constraint().literal();
+            if (ass.is_false(lit)) {
                 lvl.mark_inactive(*this, *cs);
+                continue;
+            }
+            if (!detached_.empty() && detached_.count(cs) > 0) {
+                if (!ass.is_true(lit)) {
+                    continue;
+                }
+                lvl.attach(*this, *cs);
+            }
+            if (!cs->propagate(*this, cc, check_state)) {
+                ret = false;
             }
         }
         todo_.clear();
@@ -895,6 +1142,8 @@ void Solver::undo() {
     assert(lvl.level() != 0);
 
     lvl.undo(*this);
+    // variables might have become unassigned
+    objective_last_ = 0;
 
     levels_.pop_back();
     assert(!levels_.empty());
@@ -923,13 +1172,57 @@ auto Solver::decide(Clingo::Assignment const &assign, lit_t fallback) -> lit_t {
             }
             break;
         }
+        case Heuristic::Hint: {
+            auto const &olit = litmap_at_(fallback);
+            if (olit.invalid()) {
+                break;
+            }
+            auto it = hints_.find(olit.var());
+            if (it == hints_.end()) {
+                break;
+            }
+            auto &vs = var_state(olit.var());
+            // make the variable take the hinted value or the closest value
+            // within its bounds
+            auto value = std::clamp(it->second, vs.lower_bound(), vs.upper_bound());
+            if (auto lit = vs.lit_ge(value); lit != 0 && assign.truth_value(lit) == Clingo::TruthValue::Free) {
+                return lit;
+            }
+            if (auto lit = vs.lit_lt(value); lit != 0 && assign.truth_value(lit) == Clingo::TruthValue::Free) {
+                return -lit;
+            }
+            break;
+        }
+        case Heuristic::Objective: {
+            // decide variables with large coefficients first and move them
+            // towards the bound that decreases the objective
+            bool order = litmap_at_(fallback).valid(fallback) || litmap_at_(-fallback).valid(-fallback);
+            for (auto it = objective_.begin() + objective_last_, ie = objective_.end(); it != ie; ++it) {
+                auto [co, var] = *it;
+                if (!order && std::abs(co) <= OBJECTIVE_THRESHOLD) {
+                    break;
+                }
+                auto &vs = var_state(var);
+                if (vs.is_assigned()) {
+                    if (it == objective_.begin() + objective_last_) {
+                        ++objective_last_;
+                    }
+                    continue;
+                }
+                auto lit = co > 0 ? vs.lit_ge(vs.lower_bound()) : -vs.lit_lt(vs.upper_bound());
+                if (lit != 0 && assign.truth_value(lit) == Clingo::TruthValue::Free) {
+                    return lit;
+                }
+            }
+            break;
+        }
     }
     return fallback;
 }
 
 void Solver::check_full(AbstractClauseCreator &cc, bool check_solution) {
     auto split = [&](VarState &vs) {
-        if (!vs.is_assigned()) {
+        if (!vs.is_assigned() && (aliased_.empty() || aliased_.count(vs.var()) == 0)) {
             auto value = midpoint(vs.lower_bound(), vs.upper_bound());
             static_cast<void>(get_literal(cc, vs, value));
             return true;
@@ -986,23 +1279,37 @@ void Solver::update() {
     minimize_bound_.reset();
     minimize_level_ = 0;
 
+    // constraints added while solving are added by the propagator
+    lazy_.clear();
+
     // remove solve step local variables from litmap_
-    size_t offset = 0;
-    for (auto &olit : litmap_) {
+    // Note: Only literals added since the last call to mark_variables can be
+    // solve step local.
+    for (auto lit : step_literals_) {
+        auto offset = LitmapEntry::map_offset(lit);
+        auto &olit = litmap_[offset];
         if (auto var = static_cast<var_t>(std::abs(olit.map_lit(offset))); var != 0 && var > max_static_var_) {
             auto &vs = var_state(olit.var());
             vs.unset_literal(olit.value());
             update_litmap_(vs, 0, olit.value());
             olit.unset();
         }
-        ++offset;
+    }
+    step_literals_.clear();
+    if (litmap_.size() > max_static_var_) {
+        litmap_.resize(max_static_var_);
     }
 }
 
 auto Solver::update_bounds(AbstractClauseCreator &cc, Solver &other, bool check_state) -> bool {
-    auto it = var2vs_.begin();
-    for (auto &vs_other : other.var2vs_) {
-        auto &vs = *it++;
+    // Note: Only variables whose bounds changed on the top level since the
+    // last call to mark_variables can differ from the bounds of this solver.
+    std::vector<var_t> changed{other.root_changed_.begin(), other.root_changed_.end()};
+    std::sort(changed.begin(), changed.end());
+    other.root_changed_.clear();
+    for (auto var : changed) {
+        auto &vs = var_state(var);
+        auto &vs_other = other.var_state(var);
 
         // update upper bounds
         if (vs_other.upper_bound() < vs.upper_bound()) {
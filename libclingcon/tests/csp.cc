@@ -23,12 +23,138 @@
 // }}}
 
 #include "solve.hh"
+#include <clingcon.h>
 #include <catch2/catch_test_macros.hpp>
 
 #include <iostream>
 
 using namespace Clingcon;
 
+namespace {
+
+//! Solve the given program twice, where the check callback of the first
+//! solve call restricts the given variables to values less than or equal to
+//! the given bound.
+auto solve_lazy(std::string const &prg, std::vector<char const *> const &vars, val_t bound) -> std::pair<S, S> {
+    Propagator p;
+    Clingo::Control ctl{{"0", "-t2"}};
+    ctl.add("base", {}, THEORY);
+    Clingo::AST::with_builder(ctl, [prg](Clingo::AST::ProgramBuilder &builder) {
+        Clingo::AST::parse_string(prg.c_str(), [&builder](Clingo::AST::Node const &stm) {
+            transform(
+                stm, [&builder](Clingo::AST::Node const &stm) { builder.add(stm); }, true);
+        });
+    });
+    ctl.register_propagator(p);
+    ctl.ground({{"base", {}}});
+
+    p.on_check([&p, &vars, bound](uint32_t thread_id) {
+        for (auto const *name : vars) {
+            auto var = p.get_index(Clingo::Id(name));
+            if (var.has_value() && p.get_value(*var, thread_id) > bound) {
+                p.add_lazy_sum({{1, *var}}, bound);
+            }
+        }
+    });
+    std::pair<S, S> ret;
+    for (auto *models : {&ret.first, &ret.second}) {
+        SolveEventHandler handler{p};
+        ctl.solve(Clingo::LiteralSpan{}, &handler, false, false).get();
+        std::sort(handler.models.begin(), handler.models.end());
+        *models = std::move(handler.models);
+        // constraints added while solving are kept in subsequent steps
+        p.on_check(nullptr);
+    }
+    return ret;
+}
+
+//! Get the first model of the given program with a hint for variable x.
+auto solve_hint(std::string const &prg, val_t hint) -> S {
+    Propagator p;
+    p.config().default_solver_config.heuristic = Heuristic::Hint;
+    p.set_hint(p.add_variable(Clingo::Id("x")), hint);
+    SolveEventHandler handler{p};
+    Clingo::Control ctl{{"1", "-t1"}};
+    ctl.add("base", {}, THEORY);
+    Clingo::AST::with_builder(ctl, [prg](Clingo::AST::ProgramBuilder &builder) {
+        Clingo::AST::parse_string(prg.c_str(), [&builder](Clingo::AST::Node const &stm) {
+            transform(
+                stm, [&builder](Clingo::AST::Node const &stm) { builder.add(stm); }, true);
+        });
+    });
+    ctl.register_propagator(p);
+    ctl.ground({{"base", {}}});
+    ctl.solve(Clingo::LiteralSpan{}, &handler, false, false).get();
+    return handler.models;
+}
+
+//! Solve the given program in steps and return the models of each step
+//! together with the value of the given translation statistic.
+auto solve_stat(Config const &config, std::string const &prg, Clingo::PartSpan const &parts, char const *key)
+    -> std::vector<std::pair<S, double>> {
+    Propagator p;
+    p.config() = config;
+    Clingo::Control ctl{{"0", "-t8"}};
+    ctl.add("base", {}, THEORY);
+    Clingo::AST::with_builder(ctl, [prg](Clingo::AST::ProgramBuilder &builder) {
+        Clingo::AST::parse_string(prg.c_str(), [&builder](Clingo::AST::Node const &stm) {
+            transform(
+                stm, [&builder](Clingo::AST::Node const &stm) { builder.add(stm); }, true);
+        });
+    });
+    ctl.register_propagator(p);
+
+    std::vector<std::pair<S, double>> ret;
+    for (auto const &part : parts) {
+        ctl.ground({part});
+        SolveEventHandler handler{p};
+        ctl.solve(Clingo::LiteralSpan{}, &handler, false, false).get();
+        std::sort(handler.models.begin(), handler.models.end());
+        auto value = ctl.statistics()["user_step"]["Clingcon"]["Translate"][key].value();
+        ret.emplace_back(std::move(handler.models), value);
+    }
+    return ret;
+}
+
+//! Event handler printing models using the C API.
+class TheoryEventHandler : public Clingo::SolveEventHandler {
+  public:
+    TheoryEventHandler(clingcon_theory_t *theory) : theory_{theory} {}
+
+    auto on_model(Clingo::Model &model) -> bool override {
+        Clingo::Detail::handle_error(clingcon_on_model(theory_, model.to_c()));
+        std::ostringstream oss;
+        bool sep = false;
+        auto symbols = model.symbols();
+        std::sort(symbols.begin(), symbols.end());
+        for (auto const &sym : symbols) {
+            oss << (sep ? " " : "") << sym;
+            sep = true;
+        }
+        auto thread_id = model.thread_id();
+        size_t index = 0;
+        clingcon_assignment_begin(theory_, thread_id, &index);
+        while (clingcon_assignment_next(theory_, thread_id, &index)) {
+            if (clingcon_assignment_has_value(theory_, thread_id, index)) {
+                clingcon_value_t value;
+                clingcon_assignment_get_value(theory_, thread_id, index, &value);
+                oss << (sep ? " " : "") << Clingo::Symbol{clingcon_get_symbol(theory_, index)} << "="
+                    << value.int_number; // NOLINT
+                sep = true;
+            }
+        }
+        models.emplace_back(oss.str());
+        return true;
+    }
+
+    S models;
+
+  private:
+    clingcon_theory_t *theory_;
+};
+
+} // namespace
+
 TEST_CASE("disjoint", "[solving]") {
     REQUIRE(solve("&dom{1..2}=x. &dom{1..1}=y. {a}. &disjoint{x@1;y@1} :- a.") ==
             S({"a x=2 y=1", "x=1 y=1", "x=2 y=1"}));
@@ -70,6 +196,17 @@ TEST_CASE("distinct", "[solving]") {
         REQUIRE(solve("&distinct { x; y } :- c. &sum { x } = y :- not c. {c}.", 0, 1) ==
                 S({"c x=0 y=1", "c x=1 y=0", "x=0 y=0", "x=1 y=1"}));
     }
+    SECTION("shared literals") {
+        Config config;
+        config.min_int = 0;
+        config.max_int = 2;
+        // the equality literals of y are shared by both translations
+        auto ret = solve_stat(config, "&distinct { x; y }. &distinct { y; z }.", {{"base", {}}},
+                              "Equality literals reused");
+        REQUIRE(ret.size() == 1);
+        REQUIRE(ret.front().first.size() == 12);
+        REQUIRE(ret.front().second > 0);
+    }
     SECTION("complex") {
         REQUIRE(solve("&dom{1..2}=x. &dom{1..1}=y. {a}. &distinct{x;y} :- a.") ==
                 S({"a x=2 y=1", "x=1 y=1", "x=2 y=1"}));
@@ -126,6 +263,83 @@ TEST_CASE("distinct", "[solving]") {
     }
 }
 
+TEST_CASE("count", "[solving]") {
+    SECTION("count") {
+        REQUIRE(solve("&count(1) { x; y; z } <= 1.", 0, 1) ==
+                S({"x=0 y=0 z=0", "x=0 y=0 z=1", "x=0 y=1 z=0", "x=1 y=0 z=0"}));
+        REQUIRE(solve("&count(1) { x; y; z } = 2.", 0, 1) == S({"x=0 y=1 z=1", "x=1 y=0 z=1", "x=1 y=1 z=0"}));
+        REQUIRE(solve("&count(1) { x; y; z } > 2.", 0, 1) == S({"x=1 y=1 z=1"}));
+        REQUIRE(solve("&count(2) { x; x+1 } >= 1.", 0, 2) == S({"x=1", "x=2"}));
+        REQUIRE(solve("&count(4) { 2*x; 3*y } >= 1.", 0, 2) == S({"x=2 y=0", "x=2 y=1", "x=2 y=2"}));
+        REQUIRE(solve("&count(0) { 0; x } < 1.", 0, 1) == S({}));
+        REQUIRE(solve("&count(1) { x; y } != 1.", 0, 1) == S({"x=0 y=0", "x=1 y=1"}));
+        REQUIRE(solve("&count(1) { x; y } < 2 :- c. {c}.", 0, 1) ==
+                S({"c x=0 y=0", "c x=0 y=1", "c x=1 y=0", "x=0 y=0", "x=0 y=1", "x=1 y=0", "x=1 y=1"}));
+    }
+    SECTION("gcc") {
+        REQUIRE(solve("&gcc { x; y; z; 0 @ 1; 1 @ 2 }.", 0, 1) ==
+                S({"x=0 y=1 z=1", "x=1 y=0 z=1", "x=1 y=1 z=0"}));
+        REQUIRE(solve("&gcc { x; y; z; 0 @ 0..1; 2 @ 2..3 }.", 0, 2) ==
+                S({"x=0 y=2 z=2", "x=1 y=2 z=2", "x=2 y=0 z=2", "x=2 y=1 z=2", "x=2 y=2 z=0", "x=2 y=2 z=1",
+                   "x=2 y=2 z=2"}));
+        REQUIRE(solve("&gcc { x+y; y+z; 1 @ 2..3 }.", 0, 1) == S({"x=0 y=1 z=0", "x=1 y=0 z=1"}));
+        REQUIRE(solve("&gcc { x; y; 0 @ 1; 1 @ 2 }.", 0, 1) == S({}));
+        REQUIRE(solve("&dom { 1..3 } = t(T) :- T=1..4. &count(S) { t(T) : T=1..4 } <= 2 :- S=1..3. "
+                      "&sum { t(1) } = t(2). &sum { t(2) } = t(3).")
+                    .empty());
+    }
+}
+
+TEST_CASE("max", "[solving]") {
+    SECTION("max") {
+        REQUIRE(solve("&sum { @max(x,y) } = z.", 0, 1) ==
+                S({"x=0 y=0 z=0", "x=0 y=1 z=1", "x=1 y=0 z=1", "x=1 y=1 z=1"}));
+        REQUIRE(solve("&sum { @max(x,2*y,3) } <= 3.", 0, 2) ==
+                S({"x=0 y=0", "x=0 y=1", "x=1 y=0", "x=1 y=1", "x=2 y=0", "x=2 y=1"}));
+        REQUIRE(solve("&sum { @max(x,y) } >= 1 :- a. {a}.", 0, 1) ==
+                S({"a x=0 y=1", "a x=1 y=0", "a x=1 y=1", "x=0 y=0", "x=0 y=1", "x=1 y=0", "x=1 y=1"}));
+    }
+    SECTION("min") {
+        REQUIRE(solve("&sum { @min(x,y) } = z.", 0, 1) ==
+                S({"x=0 y=0 z=0", "x=0 y=1 z=0", "x=1 y=0 z=0", "x=1 y=1 z=1"}));
+        REQUIRE(solve("&sum { @min(x,y) + @max(x,y) } = 3.", 0, 2) == S({"x=1 y=2", "x=2 y=1"}));
+    }
+    SECTION("abs") {
+        REQUIRE(solve("&sum { @abs(x) } = 1.", -2, 2) == S({"x=-1", "x=1"}));
+        REQUIRE(solve("&sum { @abs(x-y) } >= 2.", 0, 2) == S({"x=0 y=2", "x=2 y=0"}));
+    }
+    SECTION("range") {
+        REQUIRE(solve("&dom { 0..1073741822 } = x. &sum { @max(x+1,0) } >= 1073741823.") == S({"x=1073741822"}));
+        REQUIRE(solve("&sum { @abs(x) } >= 1073741823.") == S({"x=-1073741823", "x=1073741823"}));
+        REQUIRE_THROWS(solve("&sum { @max(x+1,y) } <= 3."));
+    }
+}
+
+TEST_CASE("div", "[solving]") {
+    SECTION("div") {
+        REQUIRE(solve("&sum { x / 2 } = y.", -3, 3) ==
+                S({"x=-1 y=0", "x=-2 y=-1", "x=-3 y=-1", "x=0 y=0", "x=1 y=0", "x=2 y=1", "x=3 y=1"}));
+        REQUIRE(solve("&sum { x / y } = z.", 0, 2) == S({"x=0 y=1 z=0", "x=0 y=2 z=0", "x=1 y=1 z=1", "x=1 y=2 z=0",
+                                                         "x=2 y=1 z=2", "x=2 y=2 z=1"}));
+        REQUIRE(solve("&sum { x / y } = 1. &sum { y } < 0.", -3, 3) ==
+                S({"x=-1 y=-1", "x=-2 y=-2", "x=-3 y=-2", "x=-3 y=-3"}));
+    }
+    SECTION("mod") {
+        REQUIRE(solve("&sum { x \\ 3 } = y.", -4, 4) == S({"x=-1 y=-1", "x=-2 y=-2", "x=-3 y=0", "x=-4 y=-1",
+                                                            "x=0 y=0", "x=1 y=1", "x=2 y=2", "x=3 y=0", "x=4 y=1"}));
+        REQUIRE(solve("&sum { x \\ y } = z.", 0, 2) == S({"x=0 y=1 z=0", "x=0 y=2 z=0", "x=1 y=1 z=0",
+                                                          "x=1 y=2 z=1", "x=2 y=1 z=0", "x=2 y=2 z=0"}));
+    }
+    SECTION("range") {
+        REQUIRE(solve("&sum { x / y } = z. &sum { x } = 1073741823. &sum { y } = -1.") ==
+                S({"x=1073741823 y=-1 z=-1073741823"}));
+        REQUIRE(solve("&sum { x \\ 1000 } = 999. &sum { x } >= 1073740999.") == S({"x=1073740999"}));
+        REQUIRE(solve("&sum { x \\ y } = 1. &sum { x } >= 1073741820. &dom { 2..3 } = y.") ==
+                S({"x=1073741821 y=2", "x=1073741821 y=3", "x=1073741823 y=2"}));
+        REQUIRE_THROWS(solve("&sum { (x+y) / 2 } = z."));
+    }
+}
+
 TEST_CASE("optimize", "[solving]") {
     SECTION("minimize") {
         REQUIRE(solve("&minimize { x }.", -3, 3) == S({"x=-3"}));
@@ -146,6 +360,15 @@ TEST_CASE("optimize", "[solving]") {
         REQUIRE(solve("&maximize { x }. &sum{ x } <= 0 :- a. {a}.", -3, 3) == S({"x=3"}));
         REQUIRE(solve("&maximize { x }. a :- &sum{ x } >= 0.", -3, 3) == S({"a x=3"}));
     }
+    SECTION("logarithmic translation") {
+        // the weight 3*2^30 of the highest bit does not fit into a val_t
+        for (auto const &config : create_configs()) {
+            if (config.translate_minimize_log) {
+                REQUIRE(solve(config, "&dom { -715827882..715827882 } = x. &minimize { 3*x }.") ==
+                        S({"x=-715827882"}));
+            }
+        }
+    }
 }
 
 TEST_CASE("dom", "[solving]") {
@@ -221,6 +444,45 @@ TEST_CASE("sum", "[solving]") {
     SECTION("shift") {
         REQUIRE(solve("{a}. :- a, &sum { x } < 3. :- not a, &sum { x } > 0.", 0, 3) == S({"a x=3", "x=0"}));
     }
+    SECTION("presolve") {
+        REQUIRE(solve("&sum { 2*x + 2*y } <= 3.", 0, 1) == S({"x=0 y=0", "x=0 y=1", "x=1 y=0"}));
+        REQUIRE(solve("&sum { x + y } <= 1. &sum { y + x } <= 2 :- a. {a}.", 0, 1) ==
+                S({"a x=0 y=0", "a x=0 y=1", "a x=1 y=0", "x=0 y=0", "x=0 y=1", "x=1 y=0"}));
+    }
+    SECTION("alias") {
+        REQUIRE(solve("&sum { x } = y + 1.", 0, 2) == S({"x=1 y=0", "x=2 y=1"}));
+        REQUIRE(solve("&sum { x } = y + 3.", 0, 3) == S({"x=3 y=0"}));
+        REQUIRE(solve("&sum { x + y } = 2.", 0, 2) == S({"x=0 y=2", "x=1 y=1", "x=2 y=0"}));
+        REQUIRE(solve("&sum { x } = y + 1. &sum { y } = z + 1. &sum { x + z } <= 2.", 0, 3) ==
+                S({"x=2 y=1 z=0"}));
+        // the offset of x relative to z is not a valid value
+        REQUIRE(solve("&sum { x } = y + 1000000000. &sum { y } = z + 1000000000. &sum { x } >= 1073741823.") ==
+                S({"x=1073741823 y=73741823 z=-926258177"}));
+    }
+    SECTION("subsum") {
+        REQUIRE(solve("&sum { w; x; y; z; v(X) } >= 5 :- X=1..4.", 0, 1) ==
+                S({"w=1 x=1 y=1 z=1 v(1)=1 v(2)=1 v(3)=1 v(4)=1"}));
+        REQUIRE(solve("&sum { w; x; y; z; v(X) } >= 5 :- X=1..4. &sum { w } <= 0.", 0, 1).empty());
+        REQUIRE(solve("&sum { w; x; y; z; v(X) } <= 0 :- X=1..4. &sum { w + x + y + z } >= 0.", 0, 1) ==
+                S({"w=0 x=0 y=0 z=0 v(1)=0 v(2)=0 v(3)=0 v(4)=0"}));
+        // the sub-sum exceeds the range of values and is not extracted
+        REQUIRE(solve("&dom { 0..268435456 } = w. &dom { 0..268435456 } = x. "
+                      "&dom { 0..268435456 } = y. &dom { 0..268435456 } = z. "
+                      "&sum { w; x; y; z; v(X) } >= 1073741823 :- X=1..4. &sum { v(X) } = -1 :- X=1..4.") ==
+                S({"w=268435456 x=268435456 y=268435456 z=268435456 v(1)=-1 v(2)=-1 v(3)=-1 v(4)=-1"}));
+    }
+    SECTION("probe") {
+        REQUIRE(solve("&sum { x + y } <= 3. &sum { x - y } >= 2.", 0, 3) == S({"x=2 y=0", "x=3 y=0"}));
+        REQUIRE(solve("&sum { x + y } = 3. &sum { x - y } = 1.", 0, 3) == S({"x=2 y=1"}));
+        REQUIRE(solve("&sum { x + y } >= 5. &sum { x - y } >= 2.", 0, 3).empty());
+    }
+    SECTION("merge") {
+        REQUIRE(solve("&sum { x + y } <= 1 :- a. &sum { y + x } <= 1 :- b. {a; b}.", 0, 1) ==
+                S({"a b x=0 y=0", "a b x=0 y=1", "a b x=1 y=0", "a x=0 y=0", "a x=0 y=1", "a x=1 y=0", "b x=0 y=0",
+                   "b x=0 y=1", "b x=1 y=0", "x=0 y=0", "x=0 y=1", "x=1 y=0", "x=1 y=1"}));
+        REQUIRE(solve("a :- &sum { x + y } <= 1. b :- &sum { y + x } <= 1.", 0, 1) ==
+                S({"a b x=0 y=0", "a b x=0 y=1", "a b x=1 y=0", "x=1 y=1"}));
+    }
     SECTION("bug shift") { REQUIRE(solve("{a}. b. c :- a: b.", 0, 3) == S({"a b c", "b"})); }
     SECTION("show") {
         REQUIRE(solve("&sum { p(X) } = 0 :- X=1..3. &sum { q(X) } = 0 :- X=1..3. &show { }.") == S({""}));
@@ -281,6 +543,29 @@ TEST_CASE("nsum", "[solving]") {
                    "a=1 b=-1 c=-1", "a=1 b=-2 c=-2", "a=1 b=0 c=0",  "a=1 b=1 c=1",   "a=1 b=2 c=2",
                    "a=2 b=-1 c=-2", "a=2 b=-2 c=-4", "a=2 b=0 c=0",  "a=2 b=1 c=2",   "a=2 b=2 c=4"}));
     }
+    SECTION("products") {
+        REQUIRE(solve("&dom { 1..2 } = a.\n"
+                      "&dom { 1..2 } = b.\n"
+                      "&dom { 1..2 } = c.\n"
+                      "&dom { 0..10 } = d.\n"
+                      "&nsum { a*b*c } = d.\n") == S({"a=1 b=1 c=1 d=1", "a=1 b=1 c=2 d=2", "a=1 b=2 c=1 d=2",
+                                                      "a=1 b=2 c=2 d=4", "a=2 b=1 c=1 d=2", "a=2 b=1 c=2 d=4",
+                                                      "a=2 b=2 c=1 d=4", "a=2 b=2 c=2 d=8"}));
+        REQUIRE(solve("&dom { 0..2 } = a.\n"
+                      "&dom { 0..2 } = b.\n"
+                      "&dom { 0..2 } = c.\n"
+                      "&nsum { a*b + b*c } = 3.\n") == S({"a=1 b=1 c=2", "a=2 b=1 c=1"}));
+    }
+    SECTION("range") {
+        REQUIRE(solve("&dom { 32767..32768 } = a.\n"
+                      "&dom { 32767..32767 } = b.\n"
+                      "&dom { 0..1 } = c.\n"
+                      "&nsum { a*b*c } >= 1073709056.\n") == S({"a=32768 b=32767 c=1"}));
+        REQUIRE_THROWS(solve("&dom { -32768..32768 } = a.\n"
+                             "&dom { -32768..32768 } = b.\n"
+                             "&dom { 0..1 } = c.\n"
+                             "&nsum { a*b*c } > 0.\n"));
+    }
 }
 
 TEST_CASE("multishot", "[solving]") {
@@ -328,4 +613,139 @@ TEST_CASE("multishot", "[solving]") {
                           "&sum { x } >= 5.",
                           {{"base", {}}, {"next", {}}}) == O({-3, 5}));
     }
+    SECTION("step literals") {
+        // order literals introduced while solving are discarded between steps
+        Config config;
+        config.clause_limit = 0;
+        config.weight_constraint_ratio = 0;
+        auto ret = solve_stat(config,
+                              "#program base. &dom { 0..20 } = x. &dom { 0..20 } = y. &sum { x + 2*y } = 20. "
+                              "#program next. &sum { x - y } >= 0.",
+                              {{"base", {}}, {"next", {}}}, "Translations skipped");
+        REQUIRE(ret.size() == 2);
+        REQUIRE(ret[0].first == S({"x=0 y=10", "x=10 y=5", "x=12 y=4", "x=14 y=3", "x=16 y=2", "x=18 y=1", "x=2 y=9",
+                                   "x=20 y=0", "x=4 y=8", "x=6 y=7", "x=8 y=6"}));
+        REQUIRE(ret[1].first ==
+                S({"x=10 y=5", "x=12 y=4", "x=14 y=3", "x=16 y=2", "x=18 y=1", "x=20 y=0", "x=8 y=6"}));
+    }
+    SECTION("bounds") {
+        // bounds tightened on the top level are merged into all threads
+        Config config;
+        config.clause_limit = 0;
+        config.weight_constraint_ratio = 0;
+        auto ret = solve_stat(config,
+                              "#program base. &dom { 0..20 } = x. &dom { 0..20 } = y. &sum { x + 2*y } = 20. "
+                              "#program a. &sum { x } <= 10. "
+                              "#program b. &sum { y } <= 5.",
+                              {{"base", {}}, {"a", {}}, {"b", {}}}, "Translations skipped");
+        REQUIRE(ret.size() == 3);
+        REQUIRE(ret[0].first.size() == 11);
+        REQUIRE(ret[1].first == S({"x=0 y=10", "x=10 y=5", "x=2 y=9", "x=4 y=8", "x=6 y=7", "x=8 y=6"}));
+        REQUIRE(ret[2].first == S({"x=10 y=5"}));
+    }
+    SECTION("skip") {
+        // only the constraint over the changed variables is translated again
+        Config config;
+        config.min_int = 0;
+        config.max_int = 1;
+        config.clause_limit = 0;
+        config.weight_constraint_ratio = 0;
+        auto ret = solve_stat(config,
+                              "#program base. &sum { x + y } <= 1. &sum { z + w } <= 1. "
+                              "#program next. &sum { x } >= 1.",
+                              {{"base", {}}, {"next", {}}}, "Translations skipped");
+        REQUIRE(ret.size() == 2);
+        REQUIRE(ret[0].first.size() == 9);
+        REQUIRE(ret[0].second == 0);
+        REQUIRE(ret[1].first == S({"w=0 x=1 y=0 z=0", "w=0 x=1 y=0 z=1", "w=1 x=1 y=0 z=0"}));
+        REQUIRE(ret[1].second == 1);
+    }
+}
+
+TEST_CASE("lazy", "[solving]") {
+    SECTION("simple") {
+        S expected{"x=0 y=0", "x=0 y=1", "x=1 y=0", "x=1 y=1"};
+        REQUIRE(solve_lazy("&dom { 0..3 } = x. &dom { 0..3 } = y.", {"x", "y"}, 1) == std::pair{expected, expected});
+    }
+    SECTION("alias") {
+        S expected{"x=0 y=1", "x=1 y=2"};
+        REQUIRE(solve_lazy("&dom { 0..3 } = x. &sum { x } = y - 1.", {"y"}, 2) == std::pair{expected, expected});
+        REQUIRE(solve_lazy("&dom { 0..3 } = x. &sum { x } = y - 1.", {"x"}, 1) == std::pair{expected, expected});
+    }
+}
+
+TEST_CASE("hint", "[solving]") {
+    REQUIRE(solve_hint("&dom { 0..5 } = x.", 2) == S({"x=2"}));
+    REQUIRE(solve_hint("&dom { 0..5 } = x.", 9) == S({"x=5"}));
+    REQUIRE(solve_hint("&dom { 0..5 } = x.", -3) == S({"x=0"}));
+    REQUIRE(solve_hint("&dom { 0..5 } = y. &sum { x } = y + 1.", 3) == S({"x=3 y=2"}));
+}
+
+TEST_CASE("c-api", "[solving]") {
+    clingcon_theory_t *theory = nullptr;
+    REQUIRE(clingcon_create(&theory));
+    Clingo::Control ctl{{"0"}};
+    REQUIRE(clingcon_register(theory, ctl.to_c()));
+    ctl.add("base", {}, "t. {a}.");
+    ctl.ground({{"base", {}}});
+    auto t = ctl.symbolic_atoms().find(Clingo::Id("t"))->literal();
+    auto a = ctl.symbolic_atoms().find(Clingo::Id("a"))->literal();
+
+    size_t x = 0;
+    size_t y = 0;
+    REQUIRE(clingcon_add_variable(theory, Clingo::Id("x").to_c(), &x));
+    REQUIRE(clingcon_add_variable(theory, Clingo::Id("y").to_c(), &y));
+    std::array<size_t, 2> vars{x, y};
+    std::array<int, 2> pos{1, 1};
+    std::array<int, 2> neg{-1, -1};
+    std::array<int, 2> zero{0, 0};
+    // 0 <= x,y <= 2 with one redundant constraint for presolving
+    for (auto var : vars) {
+        REQUIRE(clingcon_add_sum(theory, t, pos.data(), &var, 1, 2, false));
+        REQUIRE(clingcon_add_sum(theory, t, neg.data(), &var, 1, 0, false));
+        REQUIRE(clingcon_add_sum(theory, t, pos.data(), &var, 1, 3, false));
+    }
+    // a <-> x+y <= 1
+    REQUIRE(clingcon_add_sum(theory, a, pos.data(), vars.data(), vars.size(), 1, true));
+    // x != y
+    REQUIRE(clingcon_add_distinct(theory, t, pos.data(), vars.data(), zero.data(), vars.size()));
+
+    SECTION("solve") {
+        TheoryEventHandler handler{theory};
+        ctl.solve(Clingo::LiteralSpan{}, &handler, false, false).get();
+        std::sort(handler.models.begin(), handler.models.end());
+        REQUIRE(handler.models == S({"a t x=0 y=1", "a t x=1 y=0", "t x=0 y=2", "t x=1 y=2", "t x=2 y=0",
+                                     "t x=2 y=1"}));
+    }
+    SECTION("bound literal") {
+        clingo_literal_t lit{0};
+        clingo_literal_t other{0};
+        REQUIRE(clingcon_get_bound_literal(theory, ctl.to_c(), x, 0, &lit));
+        REQUIRE(clingcon_get_bound_literal(theory, ctl.to_c(), x, 0, &other));
+        REQUIRE(lit == other);
+        for (auto assumption : {lit, -lit}) {
+            TheoryEventHandler handler{theory};
+            ctl.solve(Clingo::LiteralSpan{&assumption, 1}, &handler, false, false).get();
+            std::sort(handler.models.begin(), handler.models.end());
+            if (assumption == lit) {
+                REQUIRE(handler.models == S({"a t x=0 y=1", "t x=0 y=2"}));
+            } else {
+                REQUIRE(handler.models == S({"a t x=1 y=0", "t x=1 y=2", "t x=2 y=0", "t x=2 y=1"}));
+            }
+        }
+        REQUIRE(clingcon_get_bound_literal(theory, ctl.to_c(), x, 0, &other));
+        REQUIRE(lit == other);
+    }
+    SECTION("invalid") {
+        auto big = std::numeric_limits<int>::max();
+        std::array<int, 1> co{big};
+        REQUIRE(!clingcon_add_sum(theory, t, co.data(), &x, 1, 0, false));
+        REQUIRE(!clingcon_add_sum(theory, t, pos.data(), &x, 1, big, false));
+        std::array<int, 2> constants{0, big};
+        REQUIRE(!clingcon_add_distinct(theory, t, pos.data(), vars.data(), constants.data(), vars.size()));
+        REQUIRE(!clingcon_set_hint(theory, x, big));
+        clingo_literal_t lit{0};
+        REQUIRE(!clingcon_get_bound_literal(theory, ctl.to_c(), x, big, &lit));
+    }
+    REQUIRE(clingcon_destroy(theory));
 }
@@ -25,6 +25,7 @@
 #include "clingcon/parsing.hh"
 #include <catch2/catch_test_macros.hpp>
 
+#include <map>
 #include <sstream>
 
 using namespace Clingcon;
@@ -154,6 +155,72 @@ class TestBuilder : public Clingcon::AbstractConstraintBuilder {
         return true;
     }
 
+    auto add_count(lit_t lit, std::vector<std::pair<CoVarVec, val_t>> const &elems, CountBoundVec const &bounds)
+        -> bool override {
+        oss_ << lit << " -> ";
+        bool sep{false};
+        for (auto const &elem : elems) {
+            oss_ << (sep ? ", " : "");
+            sep = true;
+            bool plus{false};
+            for (auto const &[co, var] : elem.first) {
+                oss_ << (plus ? " + " : "") << co << "*" << vars_[var];
+                plus = true;
+            }
+            if (elem.second != 0 || !plus) {
+                oss_ << (plus ? " + " : "") << elem.second;
+            }
+        }
+        oss_ << " :";
+        for (auto const &[value, lower, upper] : bounds) {
+            oss_ << " " << value << "@" << lower << ".." << upper;
+        }
+        oss_ << ".";
+        return true;
+    }
+
+    auto add_max(std::vector<std::pair<CoVarVec, val_t>> const &elems) -> var_t override {
+        auto var = add_variable(Clingo::Function("__max", {Clingo::Number(num_aux_++)}));
+        oss_ << vars_[var] << " = max(";
+        bool sep{false};
+        for (auto const &elem : elems) {
+            oss_ << (sep ? ", " : "");
+            sep = true;
+            print_term_(elem);
+        }
+        oss_ << ").";
+        return var;
+    }
+
+    auto add_mul(var_t var_a, var_t var_b) -> var_t override {
+        auto [it, ins] = mul_vars_.try_emplace(std::make_pair(std::min(var_a, var_b), std::max(var_a, var_b)), 0);
+        if (ins) {
+            it->second = add_variable(Clingo::Function("__mul", {Clingo::Number(num_aux_++)}));
+            oss_ << vars_[it->second] << " = " << vars_[var_a] << "*" << vars_[var_b] << ".";
+        }
+        return it->second;
+    }
+
+    auto add_div(std::pair<CoVarVec, val_t> const &x, std::pair<CoVarVec, val_t> const &y) -> var_t override {
+        auto var = add_variable(Clingo::Function("__div", {Clingo::Number(num_aux_++)}));
+        oss_ << vars_[var] << " = ";
+        print_term_(x);
+        oss_ << " / ";
+        print_term_(y);
+        oss_ << ".";
+        return var;
+    }
+
+    auto add_mod(std::pair<CoVarVec, val_t> const &x, std::pair<CoVarVec, val_t> const &y) -> var_t override {
+        auto var = add_variable(Clingo::Function("__mod", {Clingo::Number(num_aux_++)}));
+        oss_ << vars_[var] << " = ";
+        print_term_(x);
+        oss_ << " \\ ";
+        print_term_(y);
+        oss_ << ".";
+        return var;
+    }
+
     auto add_disjoint(lit_t lit, CoVarVec const &elems) -> bool override {
         oss_ << lit << " -> ";
         bool sep{false};
@@ -196,9 +263,22 @@ class TestBuilder : public Clingcon::AbstractConstraintBuilder {
     }
 
   private:
+    void print_term_(std::pair<CoVarVec, val_t> const &elem) {
+        bool plus{false};
+        for (auto const &[co, var] : elem.first) {
+            oss_ << (plus ? " + " : "") << co << "*" << vars_[var];
+            plus = true;
+        }
+        if (elem.second != 0 || !plus) {
+            oss_ << (plus ? " + " : "") << elem.second;
+        }
+    }
+
     std::ostringstream &oss_;
     bool show_{false};
     lit_t literals_{2};
+    int num_aux_{0};
+    std::map<std::pair<var_t, var_t>, var_t> mul_vars_;
     std::vector<Clingo::Symbol> vars_;
     CoVarVec minimize_;
 };
@@ -300,6 +380,34 @@ TEST_CASE("parsing", "[parsing]") {
             REQUIRE(parse("&distinct { x; y; z }.") == "2 -> 1*x != 1*y != 1*z.");
             REQUIRE(parse("&distinct { x+y; 3*y+2; z; -1 }.") == "2 -> 1*x + 1*y != 3*y + 2 != 1*z != -1.");
         }
+        SECTION("count") {
+            REQUIRE(parse("&count(1) { x; y+1; 2 } <= 1.") == "2 -> 1*x, 1*y + 1, 2 : 1@0..1.");
+            REQUIRE(parse("&count(1) { x; y } > 0.") == "2 -> 1*x, 1*y : 1@1..2.");
+            REQUIRE(parse("&count(-1) { x; y } = 1.") == "2 -> 1*x, 1*y : -1@1..1.");
+            REQUIRE(parse("&count(1) { x; y } != 1.") == "{ -2, 3, 4 }."
+                                                        "3 -> 1*x, 1*y : 1@0..0."
+                                                        "4 -> 1*x, 1*y : 1@2..2.");
+            REQUIRE(parse("&gcc { x; y; 1 @ 0..1; 2 @ 1 }.") == "2 -> 1*x, 1*y : 1@0..1 2@1..1.");
+        }
+        SECTION("max") {
+            REQUIRE(parse("&sum { @max(x, y+1) } <= 3.") == "__max(0) = max(1*x, 1*y + 1)."
+                                                            "2 -> 1*__max(0) <= 3.");
+            REQUIRE(parse("&sum { @min(x, 2*y, 5) } >= z.") == "__max(0) = max(-1*x, -2*y, -5)."
+                                                               "2 -> 1*__max(0) + 1*z <= 0.");
+            REQUIRE(parse("&sum { @abs(x-1) } = 2.") == "__max(0) = max(1*x + -1, -1*x + 1)."
+                                                        "2 -> 1*__max(0) <= 2."
+                                                        "2 -> -1*__max(0) <= -2.");
+            REQUIRE(parse("&sum { max(x, y) } <= 3.") == "2 -> 1*max(x,y) <= 3.");
+            REQUIRE_THROWS_AS(parse("&sum { @foo(x) } <= 3."), std::runtime_error);
+        }
+        SECTION("div") {
+            REQUIRE(parse("&sum { x / 7 } = y.") == "__div(0) = 1*x / 7."
+                                                    "2 -> 1*__div(0) + -1*y <= 0."
+                                                    "2 -> -1*__div(0) + 1*y <= 0.");
+            REQUIRE(parse("&sum { (x+1) \\ y } <= 2.") == "__mod(0) = 1*x + 1 \\ 1*y."
+                                                          "2 -> 1*__mod(0) <= 2.");
+            REQUIRE(parse("&sum { 7 / 2; -7 \\ 2 } <= x.") == "2 -> -1*x <= -2.");
+        }
         SECTION("disjoint") { REQUIRE(parse("&disjoint { x@10; y@1+11; z@ -10 }.") == "2 -> x@10 != y@12."); }
         SECTION("show") {
             REQUIRE(parse("&show { x/1; y }.") == "#show."
@@ -314,6 +422,14 @@ TEST_CASE("parsing", "[parsing]") {
         SECTION("nonlinear") {
             REQUIRE(parse("&nsum { 2*x*y + 3*z + 4 } <= 5.") == "2 -> 2*x*y + 3*z <= 1.");
             REQUIRE(parse("&nsum { (2**3)*x*y + (3**4)*z + (5**6) } <= 5.") == "2 -> 8*x*y + 81*z <= -15620.");
+            REQUIRE(parse("&nsum { x*y*z + w } <= 5.") == "__mul(0) = x*y."
+                                                          "2 -> 1*__mul(0)*z + 1*w <= 5.");
+            REQUIRE(parse("&nsum { x*y*z; x*y*w } <= 5.") == "__mul(0) = x*y."
+                                                           "__mul(1) = __mul(0)*z."
+                                                           "__mul(2) = __mul(0)*w."
+                                                           "2 -> 1*__mul(1) + 1*__mul(2) <= 5.");
+            REQUIRE(parse("&nsum { x*y + z + w } <= 5.") == "__mul(0) = x*y."
+                                                          "2 -> 1*__mul(0) + 1*z + 1*w <= 5.");
         }
     }
 }
@@ -91,6 +91,8 @@ class SolveEventHandler : public Clingo::SolveEventHandler {
 inline auto create_configs(val_t min_int = Clingcon::DEFAULT_MIN_INT, val_t max_int = Clingcon::DEFAULT_MAX_INT)
     -> std::vector<Config> {
     SolverConfig sconfig{Heuristic::MaxChain, 0, false, true, true, true};
+    SolverConfig hconfig{Heuristic::Hint, 0, false, true, true, true};
+    SolverConfig oconfig{Heuristic::Objective, 0, false, true, true, true};
     constexpr uint32_t m = 1000;
     constexpr double r = 1.0;
     constexpr uint64_t f = static_cast<uint64_t>(m) * 10;
@@ -104,6 +106,19 @@ inline auto create_configs(val_t min_int = Clingcon::DEFAULT_MIN_INT, val_t max_
         Config{{}, sconfig, 0, f, m, m, o, min_int, max_int, true, true, false, true, true},  // translate literals only
         Config{{}, sconfig, r, f, 0, m, o, min_int, max_int, true, false, false, true, true}, // translate weight
                                                                                               // constraints
+        Config{
+            {}, sconfig, 0, 0, 0, 0, 0, min_int, max_int, false, false, false, true, true, true}, // lazy attachment
+        Config{
+            {}, sconfig, 0, 0, 0, 0, 0, min_int, max_int, false, false, false, true, true, false, m}, // sub-sums
+        Config{
+            {}, sconfig, 0, 0, 0, 0, 0, min_int, max_int, false, false, false, true, true, false, 0, 1}, // probing
+        Config{{}, sconfig, 0, m, m, m, o, min_int, max_int, true, false, false, true, true, false, 0, 0, true}, // plan
+        Config{{}, sconfig, 0, f, m, m, o, min_int, max_int, true, false, false, true, true, false, 0, 0, false,
+               8}, // buffer
+        Config{{}, sconfig, 0, 0, 0, 0, o, min_int, max_int, true, false, false, true, true, false, 0, 0, false, 0,
+               true}, // logarithmic minimize translation
+        Config{{}, hconfig, 0, 0, 0, 0, 0, min_int, max_int, false, false, false, true, true}, // hint heuristic
+        Config{{}, oconfig, 0, 0, 0, 0, 0, min_int, max_int, false, false, false, true, true}, // objective heuristic
     };
     return configs;
 }
@@ -118,6 +118,19 @@ TEST_CASE("util", "[util]") { // NOLINT
         REQUIRE(midpoint(b, b + 3) == b + 1);
     }
 
+    SECTION("division") {
+        REQUIRE(floordiv(7, 2) == 3);
+        REQUIRE(floordiv(-7, 2) == -4);
+        REQUIRE(floordiv(7, -2) == -4);
+        REQUIRE(floordiv(-7, -2) == 3);
+        REQUIRE(floordiv(6, 2) == 3);
+        REQUIRE(ceildiv(7, 2) == 4);
+        REQUIRE(ceildiv(-7, 2) == -3);
+        REQUIRE(ceildiv(7, -2) == -3);
+        REQUIRE(ceildiv(-7, -2) == 4);
+        REQUIRE(ceildiv(-6, 2) == -3);
+    }
+
     SECTION("unique-vec") {
         std::vector<Element> elems{1, 2, 3, 4, 5};
         std::vector<Element *> ptrs;
@@ -28,8 +28,13 @@
 #if !defined(_CFFI_USE_EMBEDDING) && !defined(Py_LIMITED_API)
 #  ifdef _MSC_VER
 #    if !defined(_DEBUG) && !defined(Py_DEBUG) && !defined(Py_TRACE_REFS) && !defined(Py_REF_DEBUG) && !defined(_CFFI_NO_LIMITED_API)
-#      define Py_LIMITED_API
+#      if !defined(Py_GIL_DISABLED)
+#        define Py_LIMITED_API
+#      else
+#        define Py_LIMITED_API 0x030f0000
+#      endif
 #    endif
+
 #    include <pyconfig.h>
      /* sanity-check: Py_LIMITED_API will cause crashes if any of these
         are also defined.  Normally, the Python file PC/pyconfig.h does not
@@ -49,7 +54,11 @@
 #  else
 #    include <pyconfig.h>
 #    if !defined(Py_DEBUG) && !defined(Py_TRACE_REFS) && !defined(Py_REF_DEBUG) && !defined(_CFFI_NO_LIMITED_API)
-#      define Py_LIMITED_API
+#      if !defined(Py_GIL_DISABLED)
+#        define Py_LIMITED_API
+#      else
+#        define Py_LIMITED_API 0x030f0000
+#      endif
 #    endif
 #  endif
 #endif
@@ -59,6 +68,9 @@
 extern "C" {
 #endif
 #include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
 
 /* This part is from file 'cffi/parse_c_type.h'.  It is copied at the
    beginning of C sources generated by CFFI's ffi.set_source(). */
@@ -281,11 +293,15 @@ static int search_in_struct_unions(const struct _cffi_type_context_s *ctx,
     typedef unsigned char _Bool;
 #  endif
 # endif
+# define _cffi_float_complex_t   _Fcomplex    /* include <complex.h> for it */
+# define _cffi_double_complex_t  _Dcomplex    /* include <complex.h> for it */
 #else
 # include <stdint.h>
 # if (defined (__SVR4) && defined (__sun)) || defined(_AIX) || defined(__hpux)
 #  include <alloca.h>
 # endif
+# define _cffi_float_complex_t   float _Complex
+# define _cffi_double_complex_t  double _Complex
 #endif
 
 #ifdef __GNUC__
@@ -304,13 +320,9 @@ static int search_in_struct_unions(const struct _cffi_type_context_s *ctx,
 #ifndef PYPY_VERSION
 
 
-#if PY_MAJOR_VERSION >= 3
-# define PyInt_FromLong PyLong_FromLong
-#endif
-
 #define _cffi_from_c_double PyFloat_FromDouble
 #define _cffi_from_c_float PyFloat_FromDouble
-#define _cffi_from_c_long PyInt_FromLong
+#define _cffi_from_c_long PyLong_FromLong
 #define _cffi_from_c_ulong PyLong_FromUnsignedLong
 #define _cffi_from_c_longlong PyLong_FromLongLong
 #define _cffi_from_c_ulonglong PyLong_FromUnsignedLongLong
@@ -322,12 +334,12 @@ static int search_in_struct_unions(const struct _cffi_type_context_s *ctx,
 #define _cffi_from_c_int(x, type)                                        \
     (((type)-1) > 0 ? /* unsigned */                                     \
         (sizeof(type) < sizeof(long) ?                                   \
-            PyInt_FromLong((long)x) :                                    \
+            PyLong_FromLong((long)x) :                                   \
          sizeof(type) == sizeof(long) ?                                  \
             PyLong_FromUnsignedLong((unsigned long)x) :                  \
             PyLong_FromUnsignedLongLong((unsigned long long)x)) :        \
         (sizeof(type) <= sizeof(long) ?                                  \
-            PyInt_FromLong((long)x) :                                    \
+            PyLong_FromLong((long)x) :                                   \
             PyLong_FromLongLong((long long)x)))
 
 #define _cffi_to_c_int(o, type)                                          \
@@ -572,93 +584,141 @@ static void (*_cffi_call_python_org)(struct _cffi_externpy_s *, char *);
 /************************************************************/
 
 static void *_cffi_types[] = {
-/*  0 */ _CFFI_OP(_CFFI_OP_FUNCTION, 73), // _Bool()(clingcon_theory_t * *)
+/*  0 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t * *)
 /*  1 */ _CFFI_OP(_CFFI_OP_POINTER, 4), // clingcon_theory_t * *
 /*  2 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/*  3 */ _CFFI_OP(_CFFI_OP_FUNCTION, 73), // _Bool()(clingcon_theory_t *)
-/*  4 */ _CFFI_OP(_CFFI_OP_POINTER, 75), // clingcon_theory_t *
+/*  3 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *)
+/*  4 */ _CFFI_OP(_CFFI_OP_POINTER, 124), // clingcon_theory_t *
 /*  5 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/*  6 */ _CFFI_OP(_CFFI_OP_FUNCTION, 73), // _Bool()(clingcon_theory_t *, char const *, char const *)
+/*  6 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, _Bool(*)(clingcon_theory_t *, uint32_t, void *), void *)
 /*  7 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/*  8 */ _CFFI_OP(_CFFI_OP_POINTER, 74), // char const *
-/*  9 */ _CFFI_OP(_CFFI_OP_NOOP, 8),
+/*  8 */ _CFFI_OP(_CFFI_OP_POINTER, 89), // _Bool(*)(clingcon_theory_t *, uint32_t, void *)
+/*  9 */ _CFFI_OP(_CFFI_OP_POINTER, 134), // void *
 /* 10 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 11 */ _CFFI_OP(_CFFI_OP_FUNCTION, 73), // _Bool()(clingcon_theory_t *, clingo_ast_t *, _Bool(*)(clingo_ast_t *, void *), void *)
+/* 11 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, char const *, char const *)
 /* 12 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 13 */ _CFFI_OP(_CFFI_OP_POINTER, 78), // clingo_ast_t *
-/* 14 */ _CFFI_OP(_CFFI_OP_POINTER, 49), // _Bool(*)(clingo_ast_t *, void *)
-/* 15 */ _CFFI_OP(_CFFI_OP_POINTER, 86), // void *
-/* 16 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 17 */ _CFFI_OP(_CFFI_OP_FUNCTION, 73), // _Bool()(clingcon_theory_t *, clingo_control_t *)
-/* 18 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 19 */ _CFFI_OP(_CFFI_OP_POINTER, 79), // clingo_control_t *
-/* 20 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 21 */ _CFFI_OP(_CFFI_OP_FUNCTION, 73), // _Bool()(clingcon_theory_t *, clingo_model_t *)
-/* 22 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 23 */ _CFFI_OP(_CFFI_OP_POINTER, 80), // clingo_model_t *
-/* 24 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 25 */ _CFFI_OP(_CFFI_OP_FUNCTION, 73), // _Bool()(clingcon_theory_t *, clingo_options_t *)
-/* 26 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 27 */ _CFFI_OP(_CFFI_OP_POINTER, 81), // clingo_options_t *
-/* 28 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 29 */ _CFFI_OP(_CFFI_OP_FUNCTION, 73), // _Bool()(clingcon_theory_t *, clingo_statistics_t *, clingo_statistics_t *)
-/* 30 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 31 */ _CFFI_OP(_CFFI_OP_POINTER, 82), // clingo_statistics_t *
-/* 32 */ _CFFI_OP(_CFFI_OP_NOOP, 31),
-/* 33 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 34 */ _CFFI_OP(_CFFI_OP_FUNCTION, 73), // _Bool()(clingcon_theory_t *, uint32_t, size_t *)
-/* 35 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 36 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22), // uint32_t
-/* 37 */ _CFFI_OP(_CFFI_OP_POINTER, 42), // size_t *
-/* 38 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 39 */ _CFFI_OP(_CFFI_OP_FUNCTION, 73), // _Bool()(clingcon_theory_t *, uint32_t, size_t)
-/* 40 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 41 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 42 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28), // size_t
-/* 43 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 44 */ _CFFI_OP(_CFFI_OP_FUNCTION, 73), // _Bool()(clingcon_theory_t *, uint64_t, size_t *)
-/* 45 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 46 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24), // uint64_t
-/* 47 */ _CFFI_OP(_CFFI_OP_NOOP, 37),
-/* 48 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 49 */ _CFFI_OP(_CFFI_OP_FUNCTION, 73), // _Bool()(clingo_ast_t *, void *)
-/* 50 */ _CFFI_OP(_CFFI_OP_NOOP, 13),
-/* 51 */ _CFFI_OP(_CFFI_OP_NOOP, 15),
+/* 13 */ _CFFI_OP(_CFFI_OP_POINTER, 123), // char const *
+/* 14 */ _CFFI_OP(_CFFI_OP_NOOP, 13),
+/* 15 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 16 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, clingo_ast_t *, _Bool(*)(clingo_ast_t *, void *), void *)
+/* 17 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 18 */ _CFFI_OP(_CFFI_OP_POINTER, 127), // clingo_ast_t *
+/* 19 */ _CFFI_OP(_CFFI_OP_POINTER, 99), // _Bool(*)(clingo_ast_t *, void *)
+/* 20 */ _CFFI_OP(_CFFI_OP_NOOP, 9),
+/* 21 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 22 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, clingo_control_t *)
+/* 23 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 24 */ _CFFI_OP(_CFFI_OP_POINTER, 128), // clingo_control_t *
+/* 25 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 26 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, clingo_control_t *, size_t, int, int32_t *)
+/* 27 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 28 */ _CFFI_OP(_CFFI_OP_NOOP, 24),
+/* 29 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28), // size_t
+/* 30 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7), // int
+/* 31 */ _CFFI_OP(_CFFI_OP_POINTER, 55), // int32_t *
+/* 32 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 33 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, clingo_model_t *)
+/* 34 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 35 */ _CFFI_OP(_CFFI_OP_POINTER, 129), // clingo_model_t *
+/* 36 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 37 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, clingo_options_t *)
+/* 38 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 39 */ _CFFI_OP(_CFFI_OP_POINTER, 130), // clingo_options_t *
+/* 40 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 41 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, clingo_statistics_t *, clingo_statistics_t *)
+/* 42 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 43 */ _CFFI_OP(_CFFI_OP_POINTER, 131), // clingo_statistics_t *
+/* 44 */ _CFFI_OP(_CFFI_OP_NOOP, 43),
+/* 45 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 46 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, int const *, size_t const *, size_t, int)
+/* 47 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 48 */ _CFFI_OP(_CFFI_OP_POINTER, 30), // int const *
+/* 49 */ _CFFI_OP(_CFFI_OP_POINTER, 29), // size_t const *
+/* 50 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 51 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
 /* 52 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 53 */ _CFFI_OP(_CFFI_OP_FUNCTION, 46), // uint64_t()(clingcon_theory_t *, size_t)
+/* 53 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, int32_t, int const *, size_t const *, int const *, size_t)
 /* 54 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 55 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 56 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 57 */ _CFFI_OP(_CFFI_OP_FUNCTION, 86), // void()(clingcon_theory_t *, uint32_t, size_t *)
-/* 58 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 59 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 60 */ _CFFI_OP(_CFFI_OP_NOOP, 37),
-/* 61 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 62 */ _CFFI_OP(_CFFI_OP_FUNCTION, 86), // void()(clingcon_theory_t *, uint32_t, size_t, clingcon_value_t *)
-/* 63 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
-/* 64 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
-/* 65 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
-/* 66 */ _CFFI_OP(_CFFI_OP_POINTER, 76), // clingcon_value_t *
-/* 67 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 68 */ _CFFI_OP(_CFFI_OP_FUNCTION, 86), // void()(int *, int *, int *)
-/* 69 */ _CFFI_OP(_CFFI_OP_POINTER, 85), // int *
-/* 70 */ _CFFI_OP(_CFFI_OP_NOOP, 69),
-/* 71 */ _CFFI_OP(_CFFI_OP_NOOP, 69),
-/* 72 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
-/* 73 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1), // _Bool
-/* 74 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 2), // char
-/* 75 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 0), // clingcon_theory_t
-/* 76 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 1), // clingcon_value_t
-/* 77 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 3), // clingo_ast_statement_t
-/* 78 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 2), // clingo_ast_t
-/* 79 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 4), // clingo_control_t
-/* 80 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 5), // clingo_model_t
-/* 81 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 6), // clingo_options_t
-/* 82 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 7), // clingo_statistics_t
-/* 83 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 14), // double
-/* 84 */ _CFFI_OP(_CFFI_OP_ENUM, 0), // enum clingcon_value_type
-/* 85 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7), // int
-/* 86 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 0), // void
+/* 55 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21), // int32_t
+/* 56 */ _CFFI_OP(_CFFI_OP_NOOP, 48),
+/* 57 */ _CFFI_OP(_CFFI_OP_NOOP, 49),
+/* 58 */ _CFFI_OP(_CFFI_OP_NOOP, 48),
+/* 59 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 60 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 61 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, int32_t, int const *, size_t const *, size_t, int, _Bool)
+/* 62 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 63 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 21),
+/* 64 */ _CFFI_OP(_CFFI_OP_NOOP, 48),
+/* 65 */ _CFFI_OP(_CFFI_OP_NOOP, 49),
+/* 66 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 67 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 68 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 1), // _Bool
+/* 69 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 70 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, int64_t)
+/* 71 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 72 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 23), // int64_t
+/* 73 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 74 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, size_t, int)
+/* 75 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 76 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 77 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 7),
+/* 78 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 79 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, uint32_t, size_t *)
+/* 80 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 81 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22), // uint32_t
+/* 82 */ _CFFI_OP(_CFFI_OP_POINTER, 29), // size_t *
+/* 83 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 84 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, uint32_t, size_t)
+/* 85 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 86 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 87 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 88 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 89 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, uint32_t, void *)
+/* 90 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 91 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 92 */ _CFFI_OP(_CFFI_OP_NOOP, 9),
+/* 93 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 94 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingcon_theory_t *, uint64_t, size_t *)
+/* 95 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 96 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 24), // uint64_t
+/* 97 */ _CFFI_OP(_CFFI_OP_NOOP, 82),
+/* 98 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 99 */ _CFFI_OP(_CFFI_OP_FUNCTION, 68), // _Bool()(clingo_ast_t *, void *)
+/* 100 */ _CFFI_OP(_CFFI_OP_NOOP, 18),
+/* 101 */ _CFFI_OP(_CFFI_OP_NOOP, 9),
+/* 102 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 103 */ _CFFI_OP(_CFFI_OP_FUNCTION, 96), // uint64_t()(clingcon_theory_t *, size_t)
+/* 104 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 105 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 106 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 107 */ _CFFI_OP(_CFFI_OP_FUNCTION, 134), // void()(clingcon_theory_t *, uint32_t, size_t *)
+/* 108 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 109 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 110 */ _CFFI_OP(_CFFI_OP_NOOP, 82),
+/* 111 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 112 */ _CFFI_OP(_CFFI_OP_FUNCTION, 134), // void()(clingcon_theory_t *, uint32_t, size_t, clingcon_value_t *)
+/* 113 */ _CFFI_OP(_CFFI_OP_NOOP, 4),
+/* 114 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 22),
+/* 115 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 28),
+/* 116 */ _CFFI_OP(_CFFI_OP_POINTER, 125), // clingcon_value_t *
+/* 117 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 118 */ _CFFI_OP(_CFFI_OP_FUNCTION, 134), // void()(int *, int *, int *)
+/* 119 */ _CFFI_OP(_CFFI_OP_POINTER, 30), // int *
+/* 120 */ _CFFI_OP(_CFFI_OP_NOOP, 119),
+/* 121 */ _CFFI_OP(_CFFI_OP_NOOP, 119),
+/* 122 */ _CFFI_OP(_CFFI_OP_FUNCTION_END, 0),
+/* 123 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 2), // char
+/* 124 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 0), // clingcon_theory_t
+/* 125 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 1), // clingcon_value_t
+/* 126 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 3), // clingo_ast_statement_t
+/* 127 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 2), // clingo_ast_t
+/* 128 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 4), // clingo_control_t
+/* 129 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 5), // clingo_model_t
+/* 130 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 6), // clingo_options_t
+/* 131 */ _CFFI_OP(_CFFI_OP_STRUCT_UNION, 7), // clingo_statistics_t
+/* 132 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 14), // double
+/* 133 */ _CFFI_OP(_CFFI_OP_ENUM, 0), // enum clingcon_value_type
+/* 134 */ _CFFI_OP(_CFFI_OP_PRIMITIVE, 0), // void
 };
 
 static int _cffi_const_clingcon_value_type_int(unsigned long long *o)
@@ -682,6 +742,20 @@ static int _cffi_const_clingcon_value_type_symbol(unsigned long long *o)
   return n;
 }
 
+static struct _cffi_externpy_s _cffi_externpy__pyclingcon_check =
+  { "_clingcon.pyclingcon_check", (int)sizeof(_Bool), 0, 0 };
+
+static _Bool pyclingcon_check(clingcon_theory_t * a0, uint32_t a1, void * a2)
+{
+  char a[24];
+  char *p = a;
+  *(clingcon_theory_t * *)(p + 0) = a0;
+  *(uint32_t *)(p + 8) = a1;
+  *(void * *)(p + 16) = a2;
+  _cffi_call_python(&_cffi_externpy__pyclingcon_check, p);
+  return *(_Bool *)p;
+}
+
 static struct _cffi_externpy_s _cffi_externpy__pyclingcon_rewrite =
   { "_clingcon.pyclingcon_rewrite", (int)sizeof(_Bool), 0, 0 };
 
@@ -695,6 +769,316 @@ static _Bool pyclingcon_rewrite(clingo_ast_t * a0, void * a1)
   return *(_Bool *)p;
 }
 
+static _Bool _cffi_d_clingcon_add_distinct(clingcon_theory_t * x0, int32_t x1, int const * x2, size_t const * x3, int const * x4, size_t x5)
+{
+  return clingcon_add_distinct(x0, x1, x2, x3, x4, x5);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingcon_add_distinct(PyObject *self, PyObject *args)
+{
+  clingcon_theory_t * x0;
+  int32_t x1;
+  int const * x2;
+  size_t const * x3;
+  int const * x4;
+  size_t x5;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+  PyObject *arg3;
+  PyObject *arg4;
+  PyObject *arg5;
+
+  if (!PyArg_UnpackTuple(args, "clingcon_add_distinct", 6, 6, &arg0, &arg1, &arg2, &arg3, &arg4, &arg5))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingcon_theory_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, int32_t);
+  if (x1 == (int32_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(48), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (int const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(48), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(49), arg3, (char **)&x3);
+  if (datasize != 0) {
+    x3 = ((size_t)datasize) <= 640 ? (size_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(49), arg3, (char **)&x3,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(48), arg4, (char **)&x4);
+  if (datasize != 0) {
+    x4 = ((size_t)datasize) <= 640 ? (int const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(48), arg4, (char **)&x4,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x5 = _cffi_to_c_int(arg5, size_t);
+  if (x5 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingcon_add_distinct(x0, x1, x2, x3, x4, x5); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingcon_add_distinct _cffi_d_clingcon_add_distinct
+#endif
+
+static _Bool _cffi_d_clingcon_add_lazy_sum(clingcon_theory_t * x0, int const * x1, size_t const * x2, size_t x3, int x4)
+{
+  return clingcon_add_lazy_sum(x0, x1, x2, x3, x4);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingcon_add_lazy_sum(PyObject *self, PyObject *args)
+{
+  clingcon_theory_t * x0;
+  int const * x1;
+  size_t const * x2;
+  size_t x3;
+  int x4;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+  PyObject *arg3;
+  PyObject *arg4;
+
+  if (!PyArg_UnpackTuple(args, "clingcon_add_lazy_sum", 5, 5, &arg0, &arg1, &arg2, &arg3, &arg4))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingcon_theory_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(48), arg1, (char **)&x1);
+  if (datasize != 0) {
+    x1 = ((size_t)datasize) <= 640 ? (int const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(48), arg1, (char **)&x1,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(49), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (size_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(49), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x3 = _cffi_to_c_int(arg3, size_t);
+  if (x3 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  x4 = _cffi_to_c_int(arg4, int);
+  if (x4 == (int)-1 && PyErr_Occurred())
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingcon_add_lazy_sum(x0, x1, x2, x3, x4); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingcon_add_lazy_sum _cffi_d_clingcon_add_lazy_sum
+#endif
+
+static _Bool _cffi_d_clingcon_add_sum(clingcon_theory_t * x0, int32_t x1, int const * x2, size_t const * x3, size_t x4, int x5, _Bool x6)
+{
+  return clingcon_add_sum(x0, x1, x2, x3, x4, x5, x6);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingcon_add_sum(PyObject *self, PyObject *args)
+{
+  clingcon_theory_t * x0;
+  int32_t x1;
+  int const * x2;
+  size_t const * x3;
+  size_t x4;
+  int x5;
+  _Bool x6;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+  PyObject *arg3;
+  PyObject *arg4;
+  PyObject *arg5;
+  PyObject *arg6;
+
+  if (!PyArg_UnpackTuple(args, "clingcon_add_sum", 7, 7, &arg0, &arg1, &arg2, &arg3, &arg4, &arg5, &arg6))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingcon_theory_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, int32_t);
+  if (x1 == (int32_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(48), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (int const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(48), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(49), arg3, (char **)&x3);
+  if (datasize != 0) {
+    x3 = ((size_t)datasize) <= 640 ? (size_t const *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(49), arg3, (char **)&x3,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x4 = _cffi_to_c_int(arg4, size_t);
+  if (x4 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  x5 = _cffi_to_c_int(arg5, int);
+  if (x5 == (int)-1 && PyErr_Occurred())
+    return NULL;
+
+  x6 = (_Bool)_cffi_to_c__Bool(arg6);
+  if (x6 == (_Bool)-1 && PyErr_Occurred())
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingcon_add_sum(x0, x1, x2, x3, x4, x5, x6); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingcon_add_sum _cffi_d_clingcon_add_sum
+#endif
+
+static _Bool _cffi_d_clingcon_add_variable(clingcon_theory_t * x0, uint64_t x1, size_t * x2)
+{
+  return clingcon_add_variable(x0, x1, x2);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingcon_add_variable(PyObject *self, PyObject *args)
+{
+  clingcon_theory_t * x0;
+  uint64_t x1;
+  size_t * x2;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingcon_add_variable", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingcon_theory_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, uint64_t);
+  if (x1 == (uint64_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(82), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(82), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingcon_add_variable(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingcon_add_variable _cffi_d_clingcon_add_variable
+#endif
+
 static void _cffi_d_clingcon_assignment_begin(clingcon_theory_t * x0, uint32_t x1, size_t * x2)
 {
   clingcon_assignment_begin(x0, x1, x2);
@@ -729,10 +1113,10 @@ _cffi_f_clingcon_assignment_begin(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(37), arg2, (char **)&x2);
+      _cffi_type(82), arg2, (char **)&x2);
   if (datasize != 0) {
     x2 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(37), arg2, (char **)&x2,
+    if (_cffi_convert_array_argument(_cffi_type(82), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -792,10 +1176,10 @@ _cffi_f_clingcon_assignment_get_value(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(66), arg3, (char **)&x3);
+      _cffi_type(116), arg3, (char **)&x3);
   if (datasize != 0) {
     x3 = ((size_t)datasize) <= 640 ? (clingcon_value_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(66), arg3, (char **)&x3,
+    if (_cffi_convert_array_argument(_cffi_type(116), arg3, (char **)&x3,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -905,10 +1289,10 @@ _cffi_f_clingcon_assignment_next(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(37), arg2, (char **)&x2);
+      _cffi_type(82), arg2, (char **)&x2);
   if (datasize != 0) {
     x2 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(37), arg2, (char **)&x2,
+    if (_cffi_convert_array_argument(_cffi_type(82), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -960,19 +1344,19 @@ _cffi_f_clingcon_configure(PyObject *self, PyObject *args)
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(8), arg1, (char **)&x1);
+      _cffi_type(13), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (char const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(8), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(13), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(8), arg2, (char **)&x2);
+      _cffi_type(13), arg2, (char **)&x2);
   if (datasize != 0) {
     x2 = ((size_t)datasize) <= 640 ? (char const *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(8), arg2, (char **)&x2,
+    if (_cffi_convert_array_argument(_cffi_type(13), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -1068,6 +1452,82 @@ _cffi_f_clingcon_destroy(PyObject *self, PyObject *arg0)
 #  define _cffi_f_clingcon_destroy _cffi_d_clingcon_destroy
 #endif
 
+static _Bool _cffi_d_clingcon_get_bound_literal(clingcon_theory_t * x0, clingo_control_t * x1, size_t x2, int x3, int32_t * x4)
+{
+  return clingcon_get_bound_literal(x0, x1, x2, x3, x4);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingcon_get_bound_literal(PyObject *self, PyObject *args)
+{
+  clingcon_theory_t * x0;
+  clingo_control_t * x1;
+  size_t x2;
+  int x3;
+  int32_t * x4;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+  PyObject *arg3;
+  PyObject *arg4;
+
+  if (!PyArg_UnpackTuple(args, "clingcon_get_bound_literal", 5, 5, &arg0, &arg1, &arg2, &arg3, &arg4))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingcon_theory_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(24), arg1, (char **)&x1);
+  if (datasize != 0) {
+    x1 = ((size_t)datasize) <= 640 ? (clingo_control_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(24), arg1, (char **)&x1,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x2 = _cffi_to_c_int(arg2, size_t);
+  if (x2 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  x3 = _cffi_to_c_int(arg3, int);
+  if (x3 == (int)-1 && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(31), arg4, (char **)&x4);
+  if (datasize != 0) {
+    x4 = ((size_t)datasize) <= 640 ? (int32_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(31), arg4, (char **)&x4,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingcon_get_bound_literal(x0, x1, x2, x3, x4); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingcon_get_bound_literal _cffi_d_clingcon_get_bound_literal
+#endif
+
 static uint64_t _cffi_d_clingcon_get_symbol(clingcon_theory_t * x0, size_t x1)
 {
   return clingcon_get_symbol(x0, x1);
@@ -1152,10 +1612,10 @@ _cffi_f_clingcon_lookup_symbol(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(37), arg2, (char **)&x2);
+      _cffi_type(82), arg2, (char **)&x2);
   if (datasize != 0) {
     x2 = ((size_t)datasize) <= 640 ? (size_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(37), arg2, (char **)&x2,
+    if (_cffi_convert_array_argument(_cffi_type(82), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -1175,6 +1635,65 @@ _cffi_f_clingcon_lookup_symbol(PyObject *self, PyObject *args)
 #  define _cffi_f_clingcon_lookup_symbol _cffi_d_clingcon_lookup_symbol
 #endif
 
+static _Bool _cffi_d_clingcon_on_check(clingcon_theory_t * x0, _Bool(* x1)(clingcon_theory_t *, uint32_t, void *), void * x2)
+{
+  return clingcon_on_check(x0, x1, x2);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingcon_on_check(PyObject *self, PyObject *args)
+{
+  clingcon_theory_t * x0;
+  _Bool(* x1)(clingcon_theory_t *, uint32_t, void *);
+  void * x2;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingcon_on_check", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingcon_theory_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = (_Bool(*)(clingcon_theory_t *, uint32_t, void *))_cffi_to_c_pointer(arg1, _cffi_type(8));
+  if (x1 == (_Bool(*)(clingcon_theory_t *, uint32_t, void *))NULL && PyErr_Occurred())
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(9), arg2, (char **)&x2);
+  if (datasize != 0) {
+    x2 = ((size_t)datasize) <= 640 ? (void *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(9), arg2, (char **)&x2,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingcon_on_check(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingcon_on_check _cffi_d_clingcon_on_check
+#endif
+
 static _Bool _cffi_d_clingcon_on_model(clingcon_theory_t * x0, clingo_model_t * x1)
 {
   return clingcon_on_model(x0, x1);
@@ -1205,10 +1724,10 @@ _cffi_f_clingcon_on_model(PyObject *self, PyObject *args)
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(23), arg1, (char **)&x1);
+      _cffi_type(35), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_model_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(23), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(35), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -1260,19 +1779,19 @@ _cffi_f_clingcon_on_statistics(PyObject *self, PyObject *args)
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(31), arg1, (char **)&x1);
+      _cffi_type(43), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_statistics_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(31), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(43), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(31), arg2, (char **)&x2);
+      _cffi_type(43), arg2, (char **)&x2);
   if (datasize != 0) {
     x2 = ((size_t)datasize) <= 640 ? (clingo_statistics_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(31), arg2, (char **)&x2,
+    if (_cffi_convert_array_argument(_cffi_type(43), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -1322,10 +1841,10 @@ _cffi_f_clingcon_prepare(PyObject *self, PyObject *args)
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(19), arg1, (char **)&x1);
+      _cffi_type(24), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_control_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(19), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(24), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -1375,10 +1894,10 @@ _cffi_f_clingcon_register(PyObject *self, PyObject *args)
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(19), arg1, (char **)&x1);
+      _cffi_type(24), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_control_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(19), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(24), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -1428,10 +1947,10 @@ _cffi_f_clingcon_register_options(PyObject *self, PyObject *args)
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(27), arg1, (char **)&x1);
+      _cffi_type(39), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_options_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(27), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(39), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -1485,23 +2004,23 @@ _cffi_f_clingcon_rewrite_ast(PyObject *self, PyObject *args)
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(13), arg1, (char **)&x1);
+      _cffi_type(18), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (clingo_ast_t *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(13), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(18), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
-  x2 = (_Bool(*)(clingo_ast_t *, void *))_cffi_to_c_pointer(arg2, _cffi_type(14));
+  x2 = (_Bool(*)(clingo_ast_t *, void *))_cffi_to_c_pointer(arg2, _cffi_type(19));
   if (x2 == (_Bool(*)(clingo_ast_t *, void *))NULL && PyErr_Occurred())
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(15), arg3, (char **)&x3);
+      _cffi_type(9), arg3, (char **)&x3);
   if (datasize != 0) {
     x3 = ((size_t)datasize) <= 640 ? (void *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(15), arg3, (char **)&x3,
+    if (_cffi_convert_array_argument(_cffi_type(9), arg3, (char **)&x3,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -1521,6 +2040,108 @@ _cffi_f_clingcon_rewrite_ast(PyObject *self, PyObject *args)
 #  define _cffi_f_clingcon_rewrite_ast _cffi_d_clingcon_rewrite_ast
 #endif
 
+static _Bool _cffi_d_clingcon_set_hint(clingcon_theory_t * x0, size_t x1, int x2)
+{
+  return clingcon_set_hint(x0, x1, x2);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingcon_set_hint(PyObject *self, PyObject *args)
+{
+  clingcon_theory_t * x0;
+  size_t x1;
+  int x2;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+  PyObject *arg2;
+
+  if (!PyArg_UnpackTuple(args, "clingcon_set_hint", 3, 3, &arg0, &arg1, &arg2))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingcon_theory_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, size_t);
+  if (x1 == (size_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  x2 = _cffi_to_c_int(arg2, int);
+  if (x2 == (int)-1 && PyErr_Occurred())
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingcon_set_hint(x0, x1, x2); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingcon_set_hint _cffi_d_clingcon_set_hint
+#endif
+
+static _Bool _cffi_d_clingcon_set_minimize_bound(clingcon_theory_t * x0, int64_t x1)
+{
+  return clingcon_set_minimize_bound(x0, x1);
+}
+#ifndef PYPY_VERSION
+static PyObject *
+_cffi_f_clingcon_set_minimize_bound(PyObject *self, PyObject *args)
+{
+  clingcon_theory_t * x0;
+  int64_t x1;
+  Py_ssize_t datasize;
+  struct _cffi_freeme_s *large_args_free = NULL;
+  _Bool result;
+  PyObject *pyresult;
+  PyObject *arg0;
+  PyObject *arg1;
+
+  if (!PyArg_UnpackTuple(args, "clingcon_set_minimize_bound", 2, 2, &arg0, &arg1))
+    return NULL;
+
+  datasize = _cffi_prepare_pointer_call_argument(
+      _cffi_type(4), arg0, (char **)&x0);
+  if (datasize != 0) {
+    x0 = ((size_t)datasize) <= 640 ? (clingcon_theory_t *)alloca((size_t)datasize) : NULL;
+    if (_cffi_convert_array_argument(_cffi_type(4), arg0, (char **)&x0,
+            datasize, &large_args_free) < 0)
+      return NULL;
+  }
+
+  x1 = _cffi_to_c_int(arg1, int64_t);
+  if (x1 == (int64_t)-1 && PyErr_Occurred())
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  _cffi_restore_errno();
+  { result = clingcon_set_minimize_bound(x0, x1); }
+  _cffi_save_errno();
+  Py_END_ALLOW_THREADS
+
+  (void)self; /* unused */
+  pyresult = _cffi_from_c__Bool(result);
+  if (large_args_free != NULL) _cffi_free_array_arguments(large_args_free);
+  return pyresult;
+}
+#else
+#  define _cffi_f_clingcon_set_minimize_bound _cffi_d_clingcon_set_minimize_bound
+#endif
+
 static _Bool _cffi_d_clingcon_validate_options(clingcon_theory_t * x0)
 {
   return clingcon_validate_options(x0);
@@ -1580,28 +2201,28 @@ _cffi_f_clingcon_version(PyObject *self, PyObject *args)
     return NULL;
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(69), arg0, (char **)&x0);
+      _cffi_type(119), arg0, (char **)&x0);
   if (datasize != 0) {
     x0 = ((size_t)datasize) <= 640 ? (int *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(69), arg0, (char **)&x0,
+    if (_cffi_convert_array_argument(_cffi_type(119), arg0, (char **)&x0,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(69), arg1, (char **)&x1);
+      _cffi_type(119), arg1, (char **)&x1);
   if (datasize != 0) {
     x1 = ((size_t)datasize) <= 640 ? (int *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(69), arg1, (char **)&x1,
+    if (_cffi_convert_array_argument(_cffi_type(119), arg1, (char **)&x1,
             datasize, &large_args_free) < 0)
       return NULL;
   }
 
   datasize = _cffi_prepare_pointer_call_argument(
-      _cffi_type(69), arg2, (char **)&x2);
+      _cffi_type(119), arg2, (char **)&x2);
   if (datasize != 0) {
     x2 = ((size_t)datasize) <= 640 ? (int *)alloca((size_t)datasize) : NULL;
-    if (_cffi_convert_array_argument(_cffi_type(69), arg2, (char **)&x2,
+    if (_cffi_convert_array_argument(_cffi_type(119), arg2, (char **)&x2,
             datasize, &large_args_free) < 0)
       return NULL;
   }
@@ -1634,80 +2255,91 @@ static void _cffi_checkfld__clingcon_value_t(clingcon_value_t *p)
 struct _cffi_align__clingcon_value_t { char x; clingcon_value_t y; };
 
 static const struct _cffi_global_s _cffi_globals[] = {
-  { "clingcon_assignment_begin", (void *)_cffi_f_clingcon_assignment_begin, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 57), (void *)_cffi_d_clingcon_assignment_begin },
-  { "clingcon_assignment_get_value", (void *)_cffi_f_clingcon_assignment_get_value, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 62), (void *)_cffi_d_clingcon_assignment_get_value },
-  { "clingcon_assignment_has_value", (void *)_cffi_f_clingcon_assignment_has_value, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 39), (void *)_cffi_d_clingcon_assignment_has_value },
-  { "clingcon_assignment_next", (void *)_cffi_f_clingcon_assignment_next, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 34), (void *)_cffi_d_clingcon_assignment_next },
-  { "clingcon_configure", (void *)_cffi_f_clingcon_configure, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 6), (void *)_cffi_d_clingcon_configure },
+  { "clingcon_add_distinct", (void *)_cffi_f_clingcon_add_distinct, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 53), (void *)_cffi_d_clingcon_add_distinct },
+  { "clingcon_add_lazy_sum", (void *)_cffi_f_clingcon_add_lazy_sum, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 46), (void *)_cffi_d_clingcon_add_lazy_sum },
+  { "clingcon_add_sum", (void *)_cffi_f_clingcon_add_sum, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 61), (void *)_cffi_d_clingcon_add_sum },
+  { "clingcon_add_variable", (void *)_cffi_f_clingcon_add_variable, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 94), (void *)_cffi_d_clingcon_add_variable },
+  { "clingcon_assignment_begin", (void *)_cffi_f_clingcon_assignment_begin, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 107), (void *)_cffi_d_clingcon_assignment_begin },
+  { "clingcon_assignment_get_value", (void *)_cffi_f_clingcon_assignment_get_value, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 112), (void *)_cffi_d_clingcon_assignment_get_value },
+  { "clingcon_assignment_has_value", (void *)_cffi_f_clingcon_assignment_has_value, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 84), (void *)_cffi_d_clingcon_assignment_has_value },
+  { "clingcon_assignment_next", (void *)_cffi_f_clingcon_assignment_next, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 79), (void *)_cffi_d_clingcon_assignment_next },
+  { "clingcon_configure", (void *)_cffi_f_clingcon_configure, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 11), (void *)_cffi_d_clingcon_configure },
   { "clingcon_create", (void *)_cffi_f_clingcon_create, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 0), (void *)_cffi_d_clingcon_create },
   { "clingcon_destroy", (void *)_cffi_f_clingcon_destroy, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 3), (void *)_cffi_d_clingcon_destroy },
-  { "clingcon_get_symbol", (void *)_cffi_f_clingcon_get_symbol, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 53), (void *)_cffi_d_clingcon_get_symbol },
-  { "clingcon_lookup_symbol", (void *)_cffi_f_clingcon_lookup_symbol, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 44), (void *)_cffi_d_clingcon_lookup_symbol },
-  { "clingcon_on_model", (void *)_cffi_f_clingcon_on_model, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 21), (void *)_cffi_d_clingcon_on_model },
-  { "clingcon_on_statistics", (void *)_cffi_f_clingcon_on_statistics, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 29), (void *)_cffi_d_clingcon_on_statistics },
-  { "clingcon_prepare", (void *)_cffi_f_clingcon_prepare, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 17), (void *)_cffi_d_clingcon_prepare },
-  { "clingcon_register", (void *)_cffi_f_clingcon_register, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 17), (void *)_cffi_d_clingcon_register },
-  { "clingcon_register_options", (void *)_cffi_f_clingcon_register_options, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 25), (void *)_cffi_d_clingcon_register_options },
-  { "clingcon_rewrite_ast", (void *)_cffi_f_clingcon_rewrite_ast, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 11), (void *)_cffi_d_clingcon_rewrite_ast },
+  { "clingcon_get_bound_literal", (void *)_cffi_f_clingcon_get_bound_literal, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 26), (void *)_cffi_d_clingcon_get_bound_literal },
+  { "clingcon_get_symbol", (void *)_cffi_f_clingcon_get_symbol, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 103), (void *)_cffi_d_clingcon_get_symbol },
+  { "clingcon_lookup_symbol", (void *)_cffi_f_clingcon_lookup_symbol, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 94), (void *)_cffi_d_clingcon_lookup_symbol },
+  { "clingcon_on_check", (void *)_cffi_f_clingcon_on_check, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 6), (void *)_cffi_d_clingcon_on_check },
+  { "clingcon_on_model", (void *)_cffi_f_clingcon_on_model, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 33), (void *)_cffi_d_clingcon_on_model },
+  { "clingcon_on_statistics", (void *)_cffi_f_clingcon_on_statistics, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 41), (void *)_cffi_d_clingcon_on_statistics },
+  { "clingcon_prepare", (void *)_cffi_f_clingcon_prepare, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 22), (void *)_cffi_d_clingcon_prepare },
+  { "clingcon_register", (void *)_cffi_f_clingcon_register, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 22), (void *)_cffi_d_clingcon_register },
+  { "clingcon_register_options", (void *)_cffi_f_clingcon_register_options, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 37), (void *)_cffi_d_clingcon_register_options },
+  { "clingcon_rewrite_ast", (void *)_cffi_f_clingcon_rewrite_ast, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 16), (void *)_cffi_d_clingcon_rewrite_ast },
+  { "clingcon_set_hint", (void *)_cffi_f_clingcon_set_hint, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 74), (void *)_cffi_d_clingcon_set_hint },
+  { "clingcon_set_minimize_bound", (void *)_cffi_f_clingcon_set_minimize_bound, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 70), (void *)_cffi_d_clingcon_set_minimize_bound },
   { "clingcon_validate_options", (void *)_cffi_f_clingcon_validate_options, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_O, 3), (void *)_cffi_d_clingcon_validate_options },
   { "clingcon_value_type_double", (void *)_cffi_const_clingcon_value_type_double, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingcon_value_type_int", (void *)_cffi_const_clingcon_value_type_int, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
   { "clingcon_value_type_symbol", (void *)_cffi_const_clingcon_value_type_symbol, _CFFI_OP(_CFFI_OP_ENUM, -1), (void *)0 },
-  { "clingcon_version", (void *)_cffi_f_clingcon_version, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 68), (void *)_cffi_d_clingcon_version },
-  { "pyclingcon_rewrite", (void *)&_cffi_externpy__pyclingcon_rewrite, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 14), (void *)pyclingcon_rewrite },
+  { "clingcon_version", (void *)_cffi_f_clingcon_version, _CFFI_OP(_CFFI_OP_CPYTHON_BLTN_V, 118), (void *)_cffi_d_clingcon_version },
+  { "pyclingcon_check", (void *)&_cffi_externpy__pyclingcon_check, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 8), (void *)pyclingcon_check },
+  { "pyclingcon_rewrite", (void *)&_cffi_externpy__pyclingcon_rewrite, _CFFI_OP(_CFFI_OP_EXTERN_PYTHON, 19), (void *)pyclingcon_rewrite },
 };
 
 static const struct _cffi_field_s _cffi_fields[] = {
   { "type", offsetof(clingcon_value_t, type),
             sizeof(((clingcon_value_t *)0)->type),
-            _CFFI_OP(_CFFI_OP_NOOP, 85) },
+            _CFFI_OP(_CFFI_OP_NOOP, 30) },
   { "int_number", offsetof(clingcon_value_t, int_number),
                   sizeof(((clingcon_value_t *)0)->int_number),
-                  _CFFI_OP(_CFFI_OP_NOOP, 85) },
+                  _CFFI_OP(_CFFI_OP_NOOP, 30) },
   { "double_number", offsetof(clingcon_value_t, double_number),
                      sizeof(((clingcon_value_t *)0)->double_number),
-                     _CFFI_OP(_CFFI_OP_NOOP, 83) },
+                     _CFFI_OP(_CFFI_OP_NOOP, 132) },
   { "symbol", offsetof(clingcon_value_t, symbol),
               sizeof(((clingcon_value_t *)0)->symbol),
-              _CFFI_OP(_CFFI_OP_NOOP, 46) },
+              _CFFI_OP(_CFFI_OP_NOOP, 96) },
 };
 
 static const struct _cffi_struct_union_s _cffi_struct_unions[] = {
-  { "clingcon_theory", 75, _CFFI_F_OPAQUE,
+  { "clingcon_theory", 124, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingcon_value", 76, 0,
+  { "clingcon_value", 125, 0,
     sizeof(clingcon_value_t), offsetof(struct _cffi_align__clingcon_value_t, y), 0, 4 },
-  { "clingo_ast", 78, _CFFI_F_OPAQUE,
+  { "clingo_ast", 127, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_ast_statement", 77, _CFFI_F_OPAQUE,
+  { "clingo_ast_statement", 126, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_control", 79, _CFFI_F_OPAQUE,
+  { "clingo_control", 128, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_model", 80, _CFFI_F_OPAQUE,
+  { "clingo_model", 129, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_options", 81, _CFFI_F_OPAQUE,
+  { "clingo_options", 130, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
-  { "clingo_statistics", 82, _CFFI_F_OPAQUE,
+  { "clingo_statistics", 131, _CFFI_F_OPAQUE,
     (size_t)-1, -1, -1, 0 /* opaque */ },
 };
 
 static const struct _cffi_enum_s _cffi_enums[] = {
-  { "clingcon_value_type", 84, _cffi_prim_int(sizeof(enum clingcon_value_type), ((enum clingcon_value_type)-1) <= 0),
+  { "clingcon_value_type", 133, _cffi_prim_int(sizeof(enum clingcon_value_type), ((enum clingcon_value_type)-1) <= 0),
     "clingcon_value_type_int,clingcon_value_type_double,clingcon_value_type_symbol" },
 };
 
 static const struct _cffi_typename_s _cffi_typenames[] = {
-  { "clingcon_ast_callback_t", 14 },
-  { "clingcon_theory_t", 75 },
-  { "clingcon_value_t", 76 },
-  { "clingcon_value_type_t", 85 },
-  { "clingo_ast_statement_t", 77 },
-  { "clingo_ast_t", 78 },
-  { "clingo_control_t", 79 },
-  { "clingo_model_t", 80 },
-  { "clingo_options_t", 81 },
-  { "clingo_statistics_t", 82 },
-  { "clingo_symbol_t", 46 },
+  { "clingcon_ast_callback_t", 19 },
+  { "clingcon_check_callback_t", 8 },
+  { "clingcon_theory_t", 124 },
+  { "clingcon_value_t", 125 },
+  { "clingcon_value_type_t", 30 },
+  { "clingo_ast_statement_t", 126 },
+  { "clingo_ast_t", 127 },
+  { "clingo_control_t", 128 },
+  { "clingo_literal_t", 55 },
+  { "clingo_model_t", 129 },
+  { "clingo_options_t", 130 },
+  { "clingo_statistics_t", 131 },
+  { "clingo_symbol_t", 96 },
 };
 
 static const struct _cffi_type_context_s _cffi_type_context = {
@@ -1717,12 +2349,12 @@ static const struct _cffi_type_context_s _cffi_type_context = {
   _cffi_struct_unions,
   _cffi_enums,
   _cffi_typenames,
-  21,  /* num_globals */
+  30,  /* num_globals */
   8,  /* num_struct_unions */
   1,  /* num_enums */
-  11,  /* num_typenames */
+  13,  /* num_typenames */
   NULL,  /* no includes */
-  87,  /* num_types */
+  135,  /* num_types */
   1,  /* flags */
 };
 
@@ -1739,30 +2371,18 @@ _cffi_pypyinit__clingcon(const void *p[])
     }
     p[0] = (const void *)0x2601;
     p[1] = &_cffi_type_context;
-#if PY_MAJOR_VERSION >= 3
     return NULL;
-#endif
 }
 #  ifdef _MSC_VER
      PyMODINIT_FUNC
-#  if PY_MAJOR_VERSION >= 3
      PyInit__clingcon(void) { return NULL; }
-#  else
-     init_clingcon(void) { }
 #  endif
-#  endif
-#elif PY_MAJOR_VERSION >= 3
+#else
 PyMODINIT_FUNC
 PyInit__clingcon(void)
 {
   return _cffi_init("_clingcon", 0x2601, &_cffi_type_context);
 }
-#else
-PyMODINIT_FUNC
-init_clingcon(void)
-{
-  _cffi_init("_clingcon", 0x2601, &_cffi_type_context);
-}
 #endif
 
 #ifdef __GNUC__
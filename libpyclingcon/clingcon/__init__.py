@@ -2,15 +2,97 @@
 This module provides the clingcon theory.
 """
 
+from typing import Callable, Sequence, Tuple
+
+from clingo.control import Control
+from clingo.symbol import Symbol
 from clingo.theory import Theory
 from ._clingcon import lib as _lib, ffi as _ffi
 
 __all__ = ['ClingconTheory']
 
 
+@_ffi.def_extern()
+def pyclingcon_check(theory, thread_id, data):
+    """
+    Low-level check callback.
+    """
+    # pylint: disable=unused-argument
+    _ffi.from_handle(data)(thread_id)
+    return True
+
+
 class ClingconTheory(Theory):
     """
     A theory to register a propagator for linear constraints.
     """
     def __init__(self):
         super().__init__("clingcon", _lib, _ffi)
+        self._check_handle = None
+
+    def bound_literal(self, control: Control, var: Symbol, value: int) -> int:
+        """
+        Get a program literal that is true iff the given variable is less than
+        or equal to the given value.
+
+        The literal can be passed as an assumption when solving. It is linked
+        to the corresponding order literal in the next initialization.
+        """
+        index = self.lookup_symbol(var)
+        if index is None:
+            raise ValueError(f"unknown variable: {var}")
+        literal = _ffi.new('clingo_literal_t*')
+        if not _lib.clingcon_get_bound_literal(self._theory, control._rep, index, value, literal):
+            raise RuntimeError("could not get bound literal")
+        return literal[0]
+
+    def on_check(self, callback: Callable[[int], None]) -> None:
+        """
+        Set a callback that is called with the thread id on total assignments.
+
+        The callback can inspect the assignment using `assignment` and add
+        violated constraints using `add_lazy_sum`.
+        """
+        self._check_handle = _ffi.new_handle(callback)
+        if not _lib.clingcon_on_check(self._theory, _lib.pyclingcon_check, self._check_handle):
+            raise RuntimeError("could not set check callback")
+
+    def add_lazy_sum(self, elements: Sequence[Tuple[int, Symbol]], rhs: int) -> None:
+        """
+        Add constraint `sum(co*var for co, var in elements) <= rhs` while
+        solving.
+
+        The constraint holds globally and is added to all threads.
+        """
+        coefficients = []
+        variables = []
+        for co, var in elements:
+            index = self.lookup_symbol(var)
+            if index is None:
+                raise ValueError(f"unknown variable: {var}")
+            coefficients.append(co)
+            variables.append(index)
+        if not _lib.clingcon_add_lazy_sum(self._theory, _ffi.new('int[]', coefficients),
+                                          _ffi.new('size_t[]', variables), len(variables), rhs):
+            raise RuntimeError("could not add constraint")
+
+    def set_hint(self, var: Symbol, value: int) -> None:
+        """
+        Set the value the given variable should preferably take.
+
+        Hints take effect in the next initialization and guide the search if
+        option `--order-heuristic=hint` is used.
+        """
+        index = self.lookup_symbol(var)
+        if index is None:
+            raise ValueError(f"unknown variable: {var}")
+        if not _lib.clingcon_set_hint(self._theory, index, value):
+            raise RuntimeError("could not set hint")
+
+    def set_minimize_bound(self, bound: int) -> None:
+        """
+        Only accept models whose cost is less than or equal to the given bound
+        in the next solve call.
+        """
+        if not _lib.clingcon_set_minimize_bound(self._theory, bound):
+            raise RuntimeError("could not set minimize bound")
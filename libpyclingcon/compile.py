@@ -11,9 +11,11 @@ with open(os.path.join(path, '..', 'libclingcon', 'clingcon.h')) as f:
         if not re.match(r' *(#|//|extern *"C" *{|}$|$)', line):
             cnt.append(re.sub(r'[A-Z_]+_VISIBILITY_DEFAULT ', '', line).strip())
 cnt.append('extern "Python" bool pyclingcon_rewrite(clingo_ast_t *ast, void *data);')
+cnt.append('extern "Python" bool pyclingcon_check(clingcon_theory_t *theory, uint32_t thread_id, void *data);')
 code = '\n'.join(cnt)
 
 ffibuilder.cdef(f'''\
+typedef int32_t clingo_literal_t;
 typedef uint64_t clingo_symbol_t;
 typedef struct clingo_ast_statement clingo_ast_statement_t;
 typedef struct clingo_ast clingo_ast_t;